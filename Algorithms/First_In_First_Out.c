@@ -11,156 +11,189 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
+
+#define NO_SLICE -2
 
 void FCFS_Algo(Config* config) {
     clear_gantt_slices();
     clear_io_slices();
     
     PCB* pcb = initialize_PCB(config);
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+
+    ReadyQueue* ready = ready_queue_create(READY_FIFO, config->process_count, 0);
+    IoTimer* io_timer = io_timer_create(config->process_count);
+    if (!pcb || !ready || !io_timer) {
+        ready_queue_destroy(ready);
+        io_timer_destroy(io_timer);
+        sim_fail("Memory allocation failed in FCFS_Algo");
+        return;
+    }
 
-    QUEUE ready = { NULL, NULL, 0 };
-    QUEUE ioq   = { NULL, NULL, 0 };
-
-    int time = 0;
+    sim_time_t time = 0;
     int finished = 0;
 
-    char current_executing[32] = "";
-    int slice_start = 0;
+    int current_executing = NO_SLICE;
+    sim_time_t slice_start = 0;
+
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &finished, sizeof(finished));
+    checkpoint_add(&ck, &current_executing, sizeof(current_executing));
+    checkpoint_add(&ck, &slice_start, sizeof(slice_start));
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add_pcbs(&ck, pcb, config->process_count);
+    ready_queue_checkpoint(ready, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready, NULL);
+    io_timer_checkpoint(io_timer, &ck, &time);
 
     while (finished < config->process_count) {
-
-        for (int i = 0; i < config->process_count; i++) {
-            PROCESS p = config->processes[i];
-            if (p.arrival_time == time && !pcb[i].finished && !pcb[i].in_io) {
-                ready = add_process_to_queue(ready, p);
-                printf("[t=%d] Arrival: %s → ready queue\n", time, p.ID);
+        if (checkpoint_step(&ck)) break;
+
+        int arrived;
+        while ((arrived = arrival_stream_pop(&arrivals, time)) != -1) {
+            PROCESS p = config->processes[arrived];
+            if (!pcb[arrived].finished && !pcb[arrived].in_io) {
+                ready_queue_push(ready, arrived, 0, 0);
+                sim_printf("[t=%lld] Arrival: %s → ready queue\n", time, p.ID);
             }
         }
 
-        PROCESS io_finished_list[50];
-        int io_finished_count = 0;
-
-        QueueNode* node = ioq.start;
-        QueueNode* prev = NULL;
-
-        while (node) {
-            PCB* current_pcb = find_pcb_by_id(pcb, config->process_count, node->process.ID);
-            QueueNode* next_node = node->next;
-
-            if (current_pcb) {
-                current_pcb->io_remaining--;
-
-                if (current_pcb->io_remaining <= 0) {
-                    printf("[t=%d] %s: I/O finished → ready queue\n", time, current_pcb->process.ID);
-                    current_pcb->in_io = 0;
-                    current_pcb->io_index++;
-
-                    io_finished_list[io_finished_count++] = current_pcb->process;
+        int node;
 
-                    if (prev) prev->next = next_node;
-                    else ioq.start = next_node;
-                    if (node == ioq.end) ioq.end = prev;
-                    free(node);
-                    ioq.size--;
-                    node = next_node;
-                    continue;
-                }
-            }
+        while ((node = io_timer_pop_due(io_timer, time)) != -1) {
+            PCB* current_pcb = &pcb[node];
 
-            prev = node;
-            node = next_node;
-        }
+            sim_printf("[t=%lld] %s: I/O finished → ready queue\n", time, current_pcb->process.ID);
+            current_pcb->in_io = 0;
+            current_pcb->io_index++;
 
-        for (int i = 0; i < io_finished_count; i++) {
-            ready = add_process_to_queue(ready, io_finished_list[i]);
+            ready_queue_push(ready, node, 0, 0);
         }
 
-        char executing_now[32] = "";
+        int executing_now;
         
-        if (ready.size > 0) {
-            QueueNode* front = ready.start;
-            PROCESS p = front->process;
-            PCB* current_pcb = find_pcb_by_id(pcb, config->process_count, p.ID);
-
-            if (current_pcb) {
-                strcpy(executing_now, current_pcb->process.ID);
-                current_pcb->executed_time++;
-                current_pcb->remaining_time--;
-                printf("[t=%d] CPU → %s (executed=%d, remaining=%d)\n", 
-                       time, current_pcb->process.ID, 
-                       current_pcb->executed_time, current_pcb->remaining_time);
-
-                if (current_pcb->remaining_time <= 0) {
-                    ready = remove_process_from_queue(ready);
-                    current_pcb->finished = 1;
-                    finished++;
-                    printf("[t=%d] %s → FINISHED\n", time, current_pcb->process.ID);
-                }
-                else if (p.io_count > 0 &&
-                         current_pcb->io_index < p.io_count &&
-                         current_pcb->executed_time == p.io_operations[current_pcb->io_index].start_time &&
-                         !current_pcb->in_io) {
-                    
-                    int io_duration = p.io_operations[current_pcb->io_index].duration;
-                    
-                    ready = remove_process_from_queue(ready);
-                    current_pcb->in_io = 1;
-                    current_pcb->io_remaining = io_duration + 1;
-                    
-                    ioq = add_process_to_queue(ioq, p);
-                    
-                    add_io_slice(p.ID, time + 1, io_duration, NULL, "I/O");
-                    
-                    printf("[t=%d] %s → starts I/O (duration=%d)\n", time + 1, p.ID, io_duration);
-                }
+        if (ready_queue_size(ready) > 0) {
+            PCB* current_pcb = &pcb[ready_queue_peek(ready)];
+            PROCESS* p = &current_pcb->process;
+
+            executing_now = current_pcb - pcb;
+            current_pcb->executed_time++;
+            current_pcb->remaining_time--;
+            sim_printf("[t=%lld] CPU → %s (executed=%lld, remaining=%lld)\n", 
+                   time, current_pcb->process.ID, 
+                   current_pcb->executed_time, current_pcb->remaining_time);
+
+            if (current_pcb->remaining_time <= 0) {
+                ready_queue_pop(ready);
+                current_pcb->finished = 1;
+                finished++;
+                sim_printf("[t=%lld] %s → FINISHED\n", time, current_pcb->process.ID);
+            }
+            else if (p->io_count > 0 &&
+                     current_pcb->io_index < p->io_count &&
+                     current_pcb->executed_time == current_pcb->io_operations[current_pcb->io_index].start_time &&
+                     !current_pcb->in_io) {
+                
+                sim_time_t io_duration = current_pcb->io_operations[current_pcb->io_index].duration;
+                
+                ready_queue_pop(ready);
+                current_pcb->in_io = 1;
+                io_timer_arm(io_timer, executing_now, io_timer_due(time, io_duration + 1), 0);
+                
+                add_io_slice(executing_now, time + 1, io_duration, NULL, "I/O");
+                
+                sim_printf("[t=%lld] %s → starts I/O (duration=%lld)\n", time + 1, p->ID, io_duration);
             }
         } else {
-            strcpy(executing_now, "IDLE");
-            printf("[t=%d] CPU → IDLE\n", time);
+            executing_now = GANTT_IDLE;
+            sim_printf("[t=%lld] CPU → IDLE\n", time);
         }
         
-        if (strcmp(current_executing, executing_now) != 0) {
-            if (strlen(current_executing) > 0) {
-                int duration = time - slice_start;
-                if (strcmp(current_executing, "IDLE") == 0) {
+        if (current_executing != executing_now) {
+            if (current_executing != NO_SLICE) {
+                sim_time_t duration = time - slice_start;
+                if (current_executing == GANTT_IDLE) {
                     add_gantt_slice(current_executing, slice_start, duration, "#cccccc");
                 } else {
                     add_gantt_slice(current_executing, slice_start, duration, NULL);
                 }
             }
             
-            strcpy(current_executing, executing_now);
+            current_executing = executing_now;
             slice_start = time;
         }
 
+        Engine engine;
+        engine_start(&engine, time);
+        engine_schedule_arrival(&engine, &arrivals);
+
+        engine_schedule(&engine, io_timer_next(io_timer));
+
+        PCB* front = NULL;
+        if (ready_queue_size(ready) > 0) {
+            front = &pcb[ready_queue_peek(ready)];
+            engine_schedule_burst(&engine, front->remaining_time, front->executed_time,
+                                  pcb_next_io(front), 1);
+        }
+
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        if (quiet > 0) {
+            executing_now = front ? front - pcb : GANTT_IDLE;
+            if (current_executing != executing_now) {
+                sim_time_t duration = time + 1 - slice_start;
+                if (current_executing == GANTT_IDLE) {
+                    add_gantt_slice(current_executing, slice_start, duration, "#cccccc");
+                } else {
+                    add_gantt_slice(current_executing, slice_start, duration, NULL);
+                }
+                current_executing = executing_now;
+                slice_start = time + 1;
+            }
+
+            for (sim_time_t k = 1; k <= quiet && sim_tracing(); k++) {
+                if (front) {
+                    sim_printf("[t=%lld] CPU → %s (executed=%lld, remaining=%lld)\n",
+                           time + k, front->process.ID,
+                           front->executed_time + k, front->remaining_time - k);
+                } else {
+                    sim_printf("[t=%lld] CPU → IDLE\n", time + k);
+                }
+            }
+            if (front) {
+                front->executed_time += quiet;
+                front->remaining_time -= quiet;
+            }
+
+            time += quiet;
+        }
+
         time++;
     }
+    checkpoint_end(&ck);
 
-    if (strlen(current_executing) > 0) {
-        int duration = time - slice_start;
-        if (strcmp(current_executing, "IDLE") == 0) {
+    if (current_executing != NO_SLICE) {
+        sim_time_t duration = time - slice_start;
+        if (current_executing == GANTT_IDLE) {
             add_gantt_slice(current_executing, slice_start, duration, "#cccccc");
         } else {
             add_gantt_slice(current_executing, slice_start, duration, NULL);
         }
     }
 
-    printf("\n");
-    printf("==================== GANTT CHART ====================\n");
-    printf("Temps total: %d\n", time);
-    printf("=====================================================\n");
+    sim_printf("\n");
+    sim_printf("==================== GANTT CHART ====================\n");
+    sim_printf("Temps total: %lld\n", time);
+    sim_printf("=====================================================\n");
 
-    while (ready.start) {
-        QueueNode* temp = ready.start;
-        ready.start = ready.start->next;
-        free(temp);
-    }
-    
-    while (ioq.start) {
-        QueueNode* temp = ioq.start;
-        ioq.start = ioq.start->next;
-        free(temp);
-    }
+    ready_queue_destroy(ready);
+    io_timer_destroy(io_timer);
 
 }
\ No newline at end of file
@@ -10,41 +10,95 @@
 #include "../Config/config.h"
 #include "../Utils/Algorithms.h"
 #include "../Utils/log_file.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
 
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
-void apply_aging(PCB* pcbs, int total, int current_time, PCB* running,
-                 int aging_interval, int max_priority)
+/*
+ * Aging is tracked lazily. Every waiting process except the one picked to
+ * run gains one unit of wait_time per round, so the round at which it
+ * reaches the aging interval is known when it starts waiting and is kept
+ * in the `aging` heap (key = due round, tie = index, the order in which
+ * the promotions are reported). wait_time holds the rounds waited before
+ * `since`.
+ *
+ * A process already at max_priority is promoted to the same priority:
+ * only the trace shows it. Such processes are kept in the `at_max` heap
+ * instead, and only while the run is traced, so that an untraced run
+ * costs one heap operation per priority change.
+ */
+static void start_aging(ReadyQueue* aging, ReadyQueue* at_max, PCB* pcbs, sim_time_t* since,
+                        int i, sim_time_t round, int aging_interval, int max_priority)
 {
-    for (int i = 0; i < total; i++) {
-        PCB* p = &pcbs[i];
+    int interval = aging_interval > 1 ? aging_interval : 1;
+    ReadyQueue* heap = pcbs[i].process.priority < max_priority ? aging : at_max;
+
+    since[i] = round;
+    ready_queue_remove(aging, i);
+    ready_queue_remove(at_max, i);
+    if (heap == at_max && !sim_tracing()) return;
+    ready_queue_push(heap, i, (long long)round + interval - pcbs[i].wait_time - 1, i);
+}
+
+static void stop_aging(ReadyQueue* aging, ReadyQueue* at_max, PCB* pcbs, sim_time_t* since,
+                       int i, sim_time_t round)
+{
+    if (!ready_queue_contains(aging, i) && !ready_queue_contains(at_max, i)) return;
+
+    pcbs[i].wait_time += round - since[i];
+    ready_queue_remove(aging, i);
+    ready_queue_remove(at_max, i);
+}
+
 
-        if (p == running) continue;
-        if (p->finished) continue;
-        if (p->in_io) continue;
-        if (p->process.arrival_time > current_time) continue;
+/* Next promotion due by round, of either heap, in (due round, index) order; -1 if none. */
+static int next_aging(ReadyQueue* aging, ReadyQueue* at_max, sim_time_t round)
+{
+    int i = ready_queue_peek(aging);
+    int j = ready_queue_peek(at_max);
+    if (i != -1 && ready_queue_key(aging, i) > round) i = -1;
+    if (j != -1 && ready_queue_key(at_max, j) > round) j = -1;
+    if (i == -1) return j;
+    if (j == -1) return i;
+
+    long long ki = ready_queue_key(aging, i), kj = ready_queue_key(at_max, j);
+    return ki < kj || (ki == kj && i < j) ? i : j;
+}
 
-        p->wait_time++;
 
-        if (p->wait_time >= aging_interval) {
-            if (p->process.priority < max_priority)
-                p->process.priority++;
+void apply_aging(PCB* pcbs, ReadyQueue* aging, ReadyQueue* at_max, sim_time_t* since,
+                 sim_time_t round, sim_time_t current_time, int aging_interval,
+                 int max_priority, ReadyQueue* ready, int top_priority)
+{
+    int i;
 
-            p->wait_time = 0;
+    while ((i = next_aging(aging, at_max, round)) != -1) {
+        PCB* p = &pcbs[i];
 
-            printf("Time %d: Aging applied → %s priority is now %d\n",
-                   current_time,
-                   p->process.ID,
-                   p->process.priority);
-            log_print("Time %d: Aging applied → %s priority is now %d\n",
-                   current_time,
-                   p->process.ID,
-                   p->process.priority);
+        if (p->process.priority < max_priority) {
+            p->process.priority++;
+            ready_queue_update(ready, i, top_priority - p->process.priority);
         }
+
+        p->wait_time = 0;
+        start_aging(aging, at_max, pcbs, since, i, round + 1, aging_interval, max_priority);
+
+        sim_printf("Time %lld: Aging applied → %s priority is now %d\n",
+               current_time,
+               p->process.ID,
+               p->process.priority);
+        log_print("Time %lld: Aging applied → %s priority is now %d\n",
+               current_time,
+               p->process.ID,
+               p->process.priority);
     }
 }
 
@@ -59,54 +113,102 @@ void MultilevelAgingScheduler(Config* config,
     clear_io_slices();
     
     PCB* pcbs = initialize_PCB(config);
+    if (!pcbs) {
+        sim_fail("Memory allocation failed in MultilevelAgingScheduler");
+        return;
+    }
     int total = config->process_count;
     int finished = 0;
-    int time = 0;
+    sim_time_t time = 0;
+    /* I/O countdowns advance once per scheduling round, not once per tick. */
+    sim_time_t round = 0;
+
+    /* One level per priority reachable through aging, highest first; lowest index within a level. */
+    int top_priority = max_priority;
+    int bottom_priority = max_priority;
+    for (int i = 0; i < total; i++) {
+        int priority = pcbs[i].process.priority;
+        if (priority > top_priority) top_priority = priority;
+        if (priority < bottom_priority) bottom_priority = priority;
+    }
+    if ((long long)top_priority - bottom_priority + 1 > INT_MAX) {
+        sim_fail("Priorities %d to %d span too many levels", bottom_priority, top_priority);
+        return;
+    }
+    ReadyQueue* ready = ready_queue_create(READY_SCAN, total, top_priority - bottom_priority + 1);
+    IoTimer* io_timer = io_timer_create(total);
+    ReadyQueue* aging = ready_queue_create(READY_HEAP, total, 0);
+    ReadyQueue* at_max = ready_queue_create(READY_HEAP, total, 0);
+    sim_time_t* since = malloc(sizeof(sim_time_t) * (total > 0 ? total : 1));
+    if (!ready || !io_timer || !aging || !at_max || !since) {
+        ready_queue_destroy(ready);
+        ready_queue_destroy(aging);
+        ready_queue_destroy(at_max);
+        io_timer_destroy(io_timer);
+        free(since);
+        sim_fail("Memory allocation failed in MultilevelAgingScheduler");
+        return;
+    }
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
 
-    printf("\n=== MULTILEVEL SCHEDULER WITH AGING + I/O ===\n");
-    printf("Quantum=%d | Aging Interval=%d | Max Priority=%d\n\n",
+    sim_printf("\n=== MULTILEVEL SCHEDULER WITH AGING + I/O ===\n");
+    sim_printf("Quantum=%d | Aging Interval=%d | Max Priority=%d\n\n",
            quantum, aging_interval, max_priority);
     log_print("\n=== MULTILEVEL SCHEDULER WITH AGING + I/O ===\n");
     log_print("Quantum=%d | Aging Interval=%d | Max Priority=%d\n\n",
            quantum, aging_interval, max_priority);
 
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &round, sizeof(round));
+    checkpoint_add(&ck, &finished, sizeof(finished));
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add(&ck, since, sizeof(sim_time_t) * (total > 0 ? total : 1));
+    checkpoint_add_pcbs(&ck, pcbs, total);
+    ready_queue_checkpoint(ready, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready, NULL);
+    ready_queue_checkpoint(aging, &ck);
+    checkpoint_add_queue(&ck, "aging", CHECKPOINT_QUEUE_OTHER, aging, NULL);
+    /* Saved for the trace of a resumed run, but not part of its state. */
+    ready_queue_checkpoint(at_max, &ck);
+    io_timer_checkpoint(io_timer, &ck, &round);
+
     while (finished < total)
     {
+        if (checkpoint_step(&ck)) break;
 
-        for (int i = 0; i < total; i++) {
-            PCB* p = &pcbs[i];
-
-            if (p->in_io) {
-                p->io_remaining--;
+        int arrived;
+        while ((arrived = arrival_stream_pop(&arrivals, time)) != -1) {
+            ready_queue_push(ready, arrived, top_priority - pcbs[arrived].process.priority, arrived);
+            start_aging(aging, at_max, pcbs, since, arrived, round, aging_interval, max_priority);
+        }
 
-                if (p->io_remaining <= 0) {
-                    p->in_io = 0;
-                    p->io_index++;
-                    printf("Time %d: %s finished I/O and returned to READY\n",
-                           time, p->process.ID);
-                    log_print("Time %d: %s finished I/O and returned to READY\n",
-                           time, p->process.ID);
-                }
-            }
+        int done;
+        while ((done = io_timer_pop_due(io_timer, round)) != -1) {
+            PCB* p = &pcbs[done];
+
+            p->in_io = 0;
+            p->io_index++;
+            sim_printf("Time %lld: %s finished I/O and returned to READY\n",
+                   time, p->process.ID);
+            log_print("Time %lld: %s finished I/O and returned to READY\n",
+                   time, p->process.ID);
+            ready_queue_push(ready, done, top_priority - p->process.priority, done);
+            start_aging(aging, at_max, pcbs, since, done, round, aging_interval, max_priority);
         }
 
 
         PCB* next = NULL;
-        for (int i = 0; i < total; i++) {
-            PCB* p = &pcbs[i];
-
-            if (!p->finished && !p->in_io &&
-                p->process.arrival_time <= time) {
-
-                if (!next || p->process.priority > next->process.priority) {
-                    next = p;
-                }
-            }
+        if (ready_queue_size(ready) > 0) {
+            next = &pcbs[ready_queue_peek(ready)];
+            stop_aging(aging, at_max, pcbs, since, next - pcbs, round);
         }
 
 
-        apply_aging(pcbs, total, time, next,
-                    aging_interval, max_priority);
+        apply_aging(pcbs, aging, at_max, since, round, time,
+                    aging_interval, max_priority, ready, top_priority);
 
 
         if (next) {
@@ -114,34 +216,34 @@ void MultilevelAgingScheduler(Config* config,
             if (next->remaining_time < run_for)
                 run_for = next->remaining_time;
 
-            int actual_run = 0;
+            int actual_run = run_for > 0 ? run_for : 0;
             int io_triggered = 0;
-            
-            for (int t = 0; t < run_for; t++) {
-                add_gantt_slice(next->process.ID, time + t, 1, NULL);
-
-                next->remaining_time--;
-                next->executed_time++;
-                actual_run++;
 
+            const IO_OPERATION *io = pcb_next_io(next);
+            if (io != NULL &&
+                io->start_time > next->executed_time &&
+                io->start_time - next->executed_time <= actual_run) {
+                actual_run = io->start_time - next->executed_time;
+                io_triggered = 1;
+            }
 
-                if (next->io_index < next->process.io_count) {
-                    IO_OPERATION io = next->process.io_operations[next->io_index];
-                    if (next->executed_time == io.start_time) {
-                        next->in_io = 1;
-                        next->io_remaining = io.duration;
+            if (actual_run > 0) {
+                add_gantt_slice(next - pcbs, time, actual_run, NULL);
+            }
+            next->remaining_time -= actual_run;
+            next->executed_time += actual_run;
 
-                        printf("Time %d: %s starts I/O (duration=%d)\n",
-                               time + t + 1, next->process.ID, io.duration);
-                        log_print("Time %d: %s starts I/O (duration=%d)\n",
-                               time + t + 1, next->process.ID, io.duration);
+            if (io_triggered) {
+                next->in_io = 1;
+                ready_queue_remove(ready, next - pcbs);
+                io_timer_arm(io_timer, next - pcbs, io_timer_due(round, io->duration), next - pcbs);
 
-                        add_io_slice(next->process.ID, time + t + 1, io.duration, NULL, "I/O");
+                sim_printf("Time %lld: %s starts I/O (duration=%lld)\n",
+                       time + actual_run, next->process.ID, io->duration);
+                log_print("Time %lld: %s starts I/O (duration=%lld)\n",
+                       time + actual_run, next->process.ID, io->duration);
 
-                        io_triggered = 1;
-                        break; 
-                    }
-                }
+                add_io_slice(next - pcbs, time + actual_run, io->duration, NULL, "I/O");
             }
 
 
@@ -154,20 +256,51 @@ void MultilevelAgingScheduler(Config* config,
             if (next->remaining_time <= 0 && !next->in_io) {
                 next->finished = 1;
                 finished++;
-                printf("Time %d: %s has COMPLETED execution\n",
+                ready_queue_remove(ready, next - pcbs);
+                sim_printf("Time %lld: %s has COMPLETED execution\n",
                        time, next->process.ID);
-                log_print("Time %d: %s has COMPLETED execution\n",
+                log_print("Time %lld: %s has COMPLETED execution\n",
                        time, next->process.ID);
+            } else if (!io_triggered) {
+                start_aging(aging, at_max, pcbs, since, next - pcbs, round + 1, aging_interval, max_priority);
             }
 
         } else {
-            printf("Time %d: CPU is IDLE\n", time);
-            log_print("Time %d: CPU is IDLE\n", time);
-            add_gantt_slice("IDLE", time, 1, "#cccccc");
+            sim_printf("Time %lld: CPU is IDLE\n", time);
+            log_print("Time %lld: CPU is IDLE\n", time);
+            add_gantt_slice(GANTT_IDLE, time, 1, "#cccccc");
+
+            Engine engine;
+            engine_start(&engine, time);
+            engine_schedule_arrival(&engine, &arrivals);
+
+            if (io_timer_pending(io_timer) > 0) {
+                engine_schedule(&engine, time + io_timer_next(io_timer) - round);
+            }
+
+            sim_time_t quiet = engine_quiet_ticks(&engine);
+            if (quiet > 0) {
+                for (sim_time_t t = time + 1; t <= time + quiet && sim_tracing(); t++) {
+                    sim_printf("Time %lld: CPU is IDLE\n", t);
+                    log_print("Time %lld: CPU is IDLE\n", t);
+                }
+                add_gantt_slice(GANTT_IDLE, time + 1, quiet, "#cccccc");
+
+                time += quiet;
+                round += quiet;
+            }
             time++;
         }
+        round++;
     }
+    checkpoint_end(&ck);
+
+    ready_queue_destroy(ready);
+    ready_queue_destroy(aging);
+    ready_queue_destroy(at_max);
+    io_timer_destroy(io_timer);
+    free(since);
 
-    printf("\n*** Multilevel Aging Scheduler Completed ***\n");
+    sim_printf("\n*** Multilevel Aging Scheduler Completed ***\n");
     log_print("\n*** Multilevel Aging Scheduler Completed ***\n");
 }
\ No newline at end of file
@@ -11,8 +11,54 @@
 #include "../Config/types.h"
 #include "../Config/config.h"
 #include "../Utils/Algorithms.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
 #include "../Utils/log_file.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
+
+
+static int by_priority_desc(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x < y) - (x > y);
+}
+
+/*
+ * Run-queue level of every process: priorities never change here, so each
+ * distinct priority gets one level, 0 being the highest.
+ */
+static int* priority_levels(PCB* pcbs, int count, int* levels) {
+    int* distinct = malloc(sizeof(int) * (count > 0 ? count : 1));
+    int* level = malloc(sizeof(int) * (count > 0 ? count : 1));
+    if (!distinct || !level) {
+        free(distinct);
+        free(level);
+        return NULL;
+    }
+
+    for (int i = 0; i < count; i++) {
+        distinct[i] = pcbs[i].process.priority;
+    }
+    qsort(distinct, count, sizeof(int), by_priority_desc);
+
+    int d = 0;
+    for (int i = 0; i < count; i++) {
+        if (d == 0 || distinct[d - 1] != distinct[i]) {
+            distinct[d++] = distinct[i];
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        int* found = bsearch(&pcbs[i].process.priority, distinct, d, sizeof(int), by_priority_desc);
+        level[i] = (int)(found - distinct);
+    }
+
+    free(distinct);
+    *levels = d;
+    return level;
+}
 
 
 void MultilevelStaticScheduler(Config* config, int quantum) {
@@ -20,7 +66,11 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
     clear_io_slices();
     
     PCB* pcbs = initialize_PCB(config);
-    int time = 0;
+    if (!pcbs) {
+        sim_fail("Memory allocation failed in MultilevelStaticScheduler");
+        return;
+    }
+    sim_time_t time = 0;
     int finished_processes = 0;
     int total_processes = config->process_count;
     
@@ -28,70 +78,81 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
     int current_quantum_used = 0;
     PCB* last_executed = NULL;
 
-    printf("\n=== Multilevel Static Scheduler Start (Quantum=%d) ===\n", quantum);
-    printf("Scheduling: Priority-based with Round Robin (quantum=%d) within same priority\n\n", quantum);
+    int levels;
+    int* level = priority_levels(pcbs, total_processes, &levels);
+    if (!level) {
+        sim_fail("Memory allocation failed in MultilevelStaticScheduler");
+        return;
+    }
+    int* rank = malloc(sizeof(int) * (total_processes > 0 ? total_processes : 1));
+
+    /* One run queue per priority, highest priority first; earliest arrival first within a level. */
+    ReadyQueue* ready = ready_queue_create(READY_SCAN, total_processes, levels);
+    IoTimer* io_timer = io_timer_create(total_processes);
+    if (!rank || !ready || !io_timer) {
+        ready_queue_destroy(ready);
+        io_timer_destroy(io_timer);
+        free(level);
+        free(rank);
+        sim_fail("Memory allocation failed in MultilevelStaticScheduler");
+        return;
+    }
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+    arrival_stream_ranks(&arrivals, rank);
+
+    sim_printf("\n=== Multilevel Static Scheduler Start (Quantum=%d) ===\n", quantum);
+    sim_printf("Scheduling: Priority-based with Round Robin (quantum=%d) within same priority\n\n", quantum);
+
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &finished_processes, sizeof(finished_processes));
+    checkpoint_add(&ck, &current_quantum_used, sizeof(current_quantum_used));
+    checkpoint_add_pcb_ref(&ck, &last_executed, pcbs, total_processes);
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add_pcbs(&ck, pcbs, total_processes);
+    ready_queue_checkpoint(ready, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready, NULL);
+    io_timer_checkpoint(io_timer, &ck, &time);
 
     while (finished_processes < total_processes) {
+        if (checkpoint_step(&ck)) break;
 
 
-        for (int i = 0; i < total_processes; i++) {
-            if (pcbs[i].in_io && !pcbs[i].finished) {
-                pcbs[i].io_remaining--;
-                
-                if (pcbs[i].io_remaining <= 0) {
-                    pcbs[i].in_io = 0;
-                    printf("Time %d: %s completes I/O and returns to ready queue (Priority %d)\n", 
-                           time, pcbs[i].process.ID, pcbs[i].process.priority);
-                    log_print("Time %d: %s completes I/O\n", time, pcbs[i].process.ID);
-                }
-            }
+        int i;
+        while ((i = arrival_stream_pop(&arrivals, time)) != -1) {
+            ready_queue_push(ready, i, level[i], rank[i]);
+        }
+
+        while ((i = io_timer_pop_due(io_timer, time)) != -1) {
+            pcbs[i].in_io = 0;
+            sim_printf("Time %lld: %s completes I/O and returns to ready queue (Priority %d)\n", 
+                   time, pcbs[i].process.ID, pcbs[i].process.priority);
+            log_print("Time %lld: %s completes I/O\n", time, pcbs[i].process.ID);
+            ready_queue_push(ready, i, level[i], rank[i]);
         }
 
         PCB* next = NULL;
-        int highest_priority = -1;
-        
+        int front = ready_queue_peek(ready);
 
-        for (int i = 0; i < total_processes; i++) {
-            if (!pcbs[i].finished &&
-                !pcbs[i].in_io &&
-                pcbs[i].process.arrival_time <= time) {
-                
-                if (pcbs[i].process.priority > highest_priority) {
-                    highest_priority = pcbs[i].process.priority;
-                }
-            }
-        }
-        
 
         if (last_executed != NULL &&
-            !last_executed->finished &&
-            !last_executed->in_io &&
-            last_executed->process.arrival_time <= time &&
-            last_executed->process.priority == highest_priority &&
+            ready_queue_contains(ready, last_executed - pcbs) &&
+            last_executed->process.priority == pcbs[front].process.priority &&
             current_quantum_used < quantum) {
             next = last_executed;
         } else {
 
             current_quantum_used = 0;
-            
-            for (int i = 0; i < total_processes; i++) {
-                if (!pcbs[i].finished &&
-                    !pcbs[i].in_io &&
-                    pcbs[i].process.arrival_time <= time &&
-                    pcbs[i].process.priority == highest_priority) {
-                    
-                    if (!next) {
-                        next = &pcbs[i];
-                    } else if (pcbs[i].process.arrival_time < next->process.arrival_time) {
 
-                        next = &pcbs[i];
-                    }
-                }
+            if (front != -1) {
+                next = &pcbs[front];
             }
         }
 
         if (next) {
-            printf("Time %d: |%-4s (Priority %d, Quantum: %d/%d) | Progress: %d/%d\n",
+            sim_printf("Time %lld: |%-4s (Priority %d, Quantum: %d/%d) | Progress: %lld/%lld\n",
                    time,
                    next->process.ID,
                    next->process.priority,
@@ -100,9 +161,9 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
                    next->executed_time + 1,
                    next->process.execution_time);
             
-            log_print("Time %d: |%-4s\n", time, next->process.ID);
+            log_print("Time %lld: |%-4s\n", time, next->process.ID);
         
-            add_gantt_slice(next->process.ID, time, 1, NULL);
+            add_gantt_slice(next - pcbs, time, 1, NULL);
 
             next->remaining_time--;
             next->executed_time++;
@@ -111,19 +172,20 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
 
 
             if (next->io_index < next->process.io_count && next->remaining_time > 0) {
-                IO_OPERATION *io_op = &next->process.io_operations[next->io_index];
+                const IO_OPERATION *io_op = &next->io_operations[next->io_index];
                 
                 if (next->executed_time >= io_op->start_time) {
                     next->io_index++;
 
-                    next->io_remaining = io_op->duration + 1;
                     next->in_io = 1;
+                    io_timer_arm(io_timer, next - pcbs, io_timer_due(time, io_op->duration + 1), next - pcbs);
+                    ready_queue_remove(ready, next - pcbs);
 
-                    add_io_slice(next->process.ID, time + 1, io_op->duration, NULL, "I/O");
+                    add_io_slice(next - pcbs, time + 1, io_op->duration, NULL, "I/O");
                     
-                    printf("  -> %s blocks for I/O at time %d for %d units (will complete at time %d)\n", 
+                    sim_printf("  -> %s blocks for I/O at time %lld for %lld units (will complete at time %lld)\n", 
                            next->process.ID, time + 1, io_op->duration, time + 1 + io_op->duration);
-                    log_print("  -> %s enters I/O for %d units\n", 
+                    log_print("  -> %s enters I/O for %lld units\n", 
                              next->process.ID, io_op->duration);
 
                     current_quantum_used = 0;
@@ -132,7 +194,7 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
             }
 
             if (current_quantum_used >= quantum && next->remaining_time > 0 && !next->in_io) {
-                printf("  -> %s quantum expired, moving to back of queue\n", next->process.ID);
+                sim_printf("  -> %s quantum expired, moving to back of queue\n", next->process.ID);
                 current_quantum_used = 0;
                 last_executed = NULL;
             }
@@ -140,9 +202,10 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
             if (next->remaining_time <= 0) {
                 next->finished = 1;
                 finished_processes++;
-                printf("Process %s finished at time %d\n",
+                ready_queue_remove(ready, next - pcbs);
+                sim_printf("Process %s finished at time %lld\n",
                        next->process.ID, time + 1);
-                log_print("Process %s finished at time %d\n",
+                log_print("Process %s finished at time %lld\n",
                        next->process.ID, time + 1);
                 
                 current_quantum_used = 0;
@@ -150,16 +213,68 @@ void MultilevelStaticScheduler(Config* config, int quantum) {
             }
         } else {
 
-            printf("Time %d: CPU idle\n", time);
-            log_print("Time %d: CPU idle\n", time);
-            add_gantt_slice("IDLE", time, 1, "#cccccc");
+            sim_printf("Time %lld: CPU idle\n", time);
+            log_print("Time %lld: CPU idle\n", time);
+            add_gantt_slice(GANTT_IDLE, time, 1, "#cccccc");
             
             current_quantum_used = 0;
             last_executed = NULL;
         }
+
+        Engine engine;
+        engine_start(&engine, time);
+        engine_schedule_arrival(&engine, &arrivals);
+
+        engine_schedule(&engine, io_timer_next(io_timer));
+
+        if (last_executed != NULL) {
+            engine_schedule_burst(&engine, last_executed->remaining_time, last_executed->executed_time,
+                                  pcb_next_io(last_executed), 0);
+            engine_schedule_quantum(&engine, current_quantum_used, quantum);
+        } else if (next) {
+            engine_schedule(&engine, time + 1);
+        }
+
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        if (quiet > 0) {
+            for (sim_time_t k = 1; k <= quiet && sim_tracing(); k++) {
+                if (last_executed != NULL) {
+                    sim_printf("Time %lld: |%-4s (Priority %d, Quantum: %lld/%d) | Progress: %lld/%lld\n",
+                           time + k,
+                           last_executed->process.ID,
+                           last_executed->process.priority,
+                           current_quantum_used + k,
+                           quantum,
+                           last_executed->executed_time + k,
+                           last_executed->process.execution_time);
+
+                    log_print("Time %lld: |%-4s\n", time + k, last_executed->process.ID);
+                } else {
+                    sim_printf("Time %lld: CPU idle\n", time + k);
+                    log_print("Time %lld: CPU idle\n", time + k);
+                }
+            }
+
+            if (last_executed != NULL) {
+                last_executed->remaining_time -= quiet;
+                last_executed->executed_time += quiet;
+                current_quantum_used += quiet;
+                add_gantt_slice(last_executed - pcbs, time + 1, quiet, NULL);
+            } else {
+                add_gantt_slice(GANTT_IDLE, time + 1, quiet, "#cccccc");
+            }
+
+            time += quiet;
+        }
         
         time++;
     }
+    checkpoint_end(&ck);
+
+    ready_queue_destroy(ready);
+    free(level);
+    free(rank);
+    io_timer_destroy(io_timer);
 
-    printf("\n=== Multilevel Static Scheduler End (Total time: %d) ===\n", time);
+    sim_printf("\n=== Multilevel Static Scheduler End (Total time: %lld) ===\n", time);
 }
\ No newline at end of file
@@ -12,92 +12,74 @@
 #include "../Config/config.h"
 #include "../Config/types.h"
 #include "../Utils/Algorithms.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
 #include "../Utils/log_file.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
 
-static PCB* pick_highest_priority_and_remove(QUEUE *q, PCB *pcb, int count, int time) {
-    if (is_queue_empty(*q)) return NULL;
-
-    QueueNode *node = q->start;
-    PCB *best_pcb = NULL;
+/*
+ * Waiting time is accrued lazily: `now` counts the ticks every queued
+ * process has waited so far, since[i] its value when process i was queued,
+ * and wait_time is brought up to date when the process leaves the queue.
+ */
+typedef struct {
+    sim_time_t *since;
+    sim_time_t now;
+} WaitClock;
+
+static void make_ready(ReadyQueue *q, PCB *pcb, PCB *p, WaitClock *w) {
+    w->since[p - pcb] = w->now;
+    ready_queue_push(q, (int)(p - pcb), p->process.priority, p->process.arrival_time);
+}
 
-    while (node != NULL) {
-        PCB *current_pcb = find_pcb_by_id(pcb, count, node->process.ID);
 
-        if (current_pcb && !current_pcb->in_io && !current_pcb->finished &&
-            current_pcb->process.arrival_time <= time) {
+static void admit_arrivals(ReadyQueue *q, PCB *pcb, WaitClock *w, ArrivalStream *arrivals, sim_time_t time) {
+    int i;
 
-            if (best_pcb == NULL ||
-                current_pcb->process.priority < best_pcb->process.priority ||
-                (current_pcb->process.priority == best_pcb->process.priority &&
-                 current_pcb->process.arrival_time < best_pcb->process.arrival_time)) {
-                best_pcb = current_pcb;
-            }
-        }
-        node = node->next;
+    while ((i = arrival_stream_pop(arrivals, time)) != -1) {
+        make_ready(q, pcb, &pcb[i], w);
     }
+}
 
-    if (best_pcb) {
-        *q = remove_specific_process(*q, best_pcb->process.ID);
-    }
 
-    return best_pcb;
+static PCB* pick_highest_priority_and_remove(ReadyQueue *q, PCB *pcb, WaitClock *w) {
+    int best = ready_queue_pop(q);
+    if (best == -1) return NULL;
+
+    pcb[best].wait_time += w->now - w->since[best];
+    return &pcb[best];
 }
 
 
 static int needs_io_after_current_execution(PCB *p) {
     if (p->io_index >= p->process.io_count) return 0;
 
-    IO_OPERATION *io_op = &p->process.io_operations[p->io_index];
+    const IO_OPERATION *io_op = &p->io_operations[p->io_index];
 
     return (p->executed_time >= io_op->start_time);
 }
 
 
-static QUEUE process_io_queue(QUEUE *ioq, PCB *pcb, int count, int time) {
-    QUEUE finished_io = {NULL, NULL, 0};
-
-    if (is_queue_empty(*ioq)) return finished_io;
-
-    QueueNode *node = ioq->start;
+static void process_io_queue(IoTimer *io_timer, QUEUE *finished_io, PCB *pcb, sim_time_t time) {
+    int node;
 
-    while (node != NULL) {
-        PCB *p = find_pcb_by_id(pcb, count, node->process.ID);
-        QueueNode *next_node = node->next;
+    while ((node = io_timer_pop_due(io_timer, time)) != -1) {
+        PCB *p = &pcb[node];
 
-        if (p && p->in_io) {
-            p->io_remaining--;
+        p->in_io = 0;
 
-            if (p->io_remaining <= 0) {
-                *ioq = remove_specific_process(*ioq, p->process.ID);
-                p->in_io = 0;
-                p->io_remaining = 0;
+        add_process_to_queue(finished_io, node);
 
-                finished_io = add_process_to_queue(finished_io, p->process);
-
-                printf("t=%d: %s completes IO and will be READY next tick\n", time, p->process.ID);
-                log_print("t=%d: %s completes IO and will be READY next tick\n", time, p->process.ID);
-            }
-        }
-
-        node = next_node;
+        sim_printf("t=%lld: %s completes IO and will be READY next tick\n", time, p->process.ID);
+        log_print("t=%lld: %s completes IO and will be READY next tick\n", time, p->process.ID);
     }
-
-    return finished_io;
 }
 
 
-static void update_wait_times(QUEUE *readyq, PCB *pcb, int count, PCB *running, int time) {
-    QueueNode *node = readyq->start;
-
-    while (node != NULL) {
-        PCB *p = find_pcb_by_id(pcb, count, node->process.ID);
-
-        if (p && p->process.arrival_time <= time && p != running && !p->finished) {
-            p->wait_time++;
-        }
-        node = node->next;
-    }
+static void update_wait_times(WaitClock *w, sim_time_t amount) {
+    w->now += amount;
 }
 
 
@@ -110,135 +92,220 @@ void run_priority_preemptive(Config *config) {
     int count = config->process_count;
     PCB *pcbs = initialize_PCB(config);
 
-    QUEUE readyq = {NULL, NULL, 0};
-    QUEUE ioq = {NULL, NULL, 0};
-
-
-    for (int i = 0; i < count; i++) {
-        readyq = add_process_to_queue(readyq, pcbs[i].process);
+    ReadyQueue *readyq = ready_queue_create(READY_SCAN, count, 0);
+    IoTimer *io_timer = io_timer_create(count);
+    QueuePool *pool = queue_pool_create(count);
+    QUEUE io_finished;
+    queue_init(&io_finished, pool);
+
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+
+    WaitClock waits;
+    waits.now = 0;
+    waits.since = malloc(sizeof(sim_time_t) * count);
+    if (!pcbs || !readyq || !io_timer || !pool || !waits.since) {
+        ready_queue_destroy(readyq);
+        io_timer_destroy(io_timer);
+        queue_pool_destroy(pool);
+        free(waits.since);
+        sim_fail("Memory allocation failed in run_priority_preemptive");
+        return;
     }
+    int finished_count = 0;
 
     PCB *running = NULL;
-    int time = 0;
+    sim_time_t time = 0;
 
-    printf("--- Simulation Start ---\n");
+    sim_printf("--- Simulation Start ---\n");
     log_print("--- Priority Preemptive Algorithm Started ***\n\n");
 
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &finished_count, sizeof(finished_count));
+    checkpoint_add_pcb_ref(&ck, &running, pcbs, count);
+    checkpoint_add(&ck, &waits.now, sizeof(waits.now));
+    checkpoint_add(&ck, waits.since, sizeof(sim_time_t) * count);
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add(&ck, &io_finished.start, sizeof(io_finished.start));
+    checkpoint_add(&ck, &io_finished.end, sizeof(io_finished.end));
+    checkpoint_add(&ck, &io_finished.size, sizeof(io_finished.size));
+    checkpoint_add(&ck, pool->next, 2 * count * sizeof(int));
+    checkpoint_add_pcbs(&ck, pcbs, count);
+    ready_queue_checkpoint(readyq, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, readyq, NULL);
+    io_timer_checkpoint(io_timer, &ck, &time);
+
     while (1) {
-        printf("\nt=%d: ", time);
+        if (checkpoint_step(&ck)) break;
+        sim_printf("\nt=%lld: ", time);
 
 
-        QUEUE io_finished = process_io_queue(&ioq, pcbs, count, time);
+        process_io_queue(io_timer, &io_finished, pcbs, time);
 
+        admit_arrivals(readyq, pcbs, &waits, &arrivals, time);
 
         if (!running) {
-            PCB *next = pick_highest_priority_and_remove(&readyq, pcbs, count, time);
+            PCB *next = pick_highest_priority_and_remove(readyq, pcbs, &waits);
             if (next) {
                 running = next;
-                printf("%s starts running\n", running->process.ID);
+                sim_printf("%s starts running\n", running->process.ID);
                 log_print("%s starts running\n", running->process.ID);
             }
         }
 
         if (running) {
-            PCB *higher = pick_highest_priority_and_remove(&readyq, pcbs, count, time);
+            PCB *higher = pick_highest_priority_and_remove(readyq, pcbs, &waits);
             if (higher) {
                 if (higher->process.priority < running->process.priority) {
-                    printf("%s preempted by %s\n", running->process.ID, higher->process.ID);
+                    sim_printf("%s preempted by %s\n", running->process.ID, higher->process.ID);
                     log_print("%s preempted by %s\n", running->process.ID, higher->process.ID);
-                    readyq = add_process_to_queue(readyq, running->process);
+                    make_ready(readyq, pcbs, running, &waits);
                     running = higher;
                 } else {
-                    readyq = add_process_to_queue(readyq, higher->process);
+                    make_ready(readyq, pcbs, higher, &waits);
                 }
             }
         }
 
 
+        int was_running = running != NULL;
+
         if (running) {
-            printf("%s executes\n", running->process.ID);
+            sim_printf("%s executes\n", running->process.ID);
             log_print("%s executes\n", running->process.ID);
-            add_gantt_slice(running->process.ID, time, 1, NULL);
+            add_gantt_slice(running - pcbs, time, 1, NULL);
             running->remaining_time--;
             running->executed_time++;
 
 
             if (running->remaining_time <= 0) {
-                printf("t=%d: %s FINISHED\n", time + 1, running->process.ID);
-                log_print("t=%d: %s FINISHED\n", time + 1, running->process.ID);
+                sim_printf("t=%lld: %s FINISHED\n", time + 1, running->process.ID);
+                log_print("t=%lld: %s FINISHED\n", time + 1, running->process.ID);
                 running->finished = 1;
+                finished_count++;
                 running = NULL;
             } 
 
             else if (needs_io_after_current_execution(running)) {
-                IO_OPERATION *io_op = &running->process.io_operations[running->io_index];
+                const IO_OPERATION *io_op = &running->io_operations[running->io_index];
                 running->io_index++;
 
-                running->io_remaining = io_op->duration;
                 running->in_io = 1;
-                ioq = add_process_to_queue(ioq, running->process);
+                io_timer_arm(io_timer, running - pcbs, io_timer_due(time, io_op->duration), 0);
 
-                add_io_slice(running->process.ID, time + 1, io_op->duration, NULL, "I/O");
+                add_io_slice(running - pcbs, time + 1, io_op->duration, NULL, "I/O");
 
-                printf("t=%d: %s enters IO for %d units (will complete at t=%d)\n", 
+                sim_printf("t=%lld: %s enters IO for %lld units (will complete at t=%lld)\n", 
                        time + 1, running->process.ID, io_op->duration, time + 1 + io_op->duration);
-                log_print("t=%d: %s enters IO for %d units\n", 
+                log_print("t=%lld: %s enters IO for %lld units\n", 
                           time + 1, running->process.ID, io_op->duration);
                 running = NULL;
             }
         } else {
 
-            int io_busy = !is_queue_empty(ioq);
+            int io_busy = io_timer_pending(io_timer) > 0;
             if (io_busy) {
-                printf("CPU idle (IO device busy)\n");
+                sim_printf("CPU idle (IO device busy)\n");
                 log_print("CPU idle (IO device busy)\n");
-            } else if (!is_queue_empty(readyq)) {
-                printf("CPU idle (processes in ready queue)\n");
+            } else if (ready_queue_size(readyq) > 0 || arrival_stream_pending(&arrivals) > 0) {
+                sim_printf("CPU idle (processes in ready queue)\n");
                 log_print("CPU idle (processes in ready queue)\n");
             } else {
-                printf("CPU idle\n");
+                sim_printf("CPU idle\n");
                 log_print("CPU idle\n");
             }
-            add_gantt_slice("IDLE", time, 1, "#cccccc");
+            add_gantt_slice(GANTT_IDLE, time, 1, "#cccccc");
         }
 
-        update_wait_times(&readyq, pcbs, count, running, time);
+        update_wait_times(&waits, 1);
 
 
-        QueueNode *node = io_finished.start;
-        while (node != NULL) {
-            readyq = add_process_to_queue(readyq, node->process);
-            node = node->next;
+        int io_returned = io_finished.size;
+        while (!is_queue_empty(&io_finished)) {
+            make_ready(readyq, pcbs, &pcbs[remove_process_from_queue(&io_finished)], &waits);
         }
-        io_finished.start = io_finished.end = NULL;
-        io_finished.size = 0;
 
 
-        int all_done = 1;
-        for (int i = 0; i < count; i++) {
-            if (!pcbs[i].finished) {
-                all_done = 0;
-                break;
-            }
+        if (finished_count == count && !running && ready_queue_size(readyq) == 0 && io_timer_pending(io_timer) == 0) {
+            break;
         }
 
-        if (all_done && !running && is_queue_empty(readyq) && is_queue_empty(ioq)) {
-            break;
+        Engine engine;
+        engine_start(&engine, time);
+        engine_schedule_arrival(&engine, &arrivals);
+
+        engine_schedule(&engine, io_timer_next(io_timer));
+
+        if (io_returned > 0) {
+            engine_schedule(&engine, time + 1);
+        }
+
+        if (running) {
+            engine_schedule_burst(&engine, running->remaining_time, running->executed_time,
+                                  pcb_next_io(running), 0);
+        } else if (was_running) {
+            engine_schedule(&engine, time + 1);
+        }
+
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        if (quiet > 0) {
+            int io_busy = io_timer_pending(io_timer) > 0;
+            int ready_waiting = ready_queue_size(readyq) > 0 || arrival_stream_pending(&arrivals) > 0;
+
+            for (sim_time_t t = time + 1; t <= time + quiet && sim_tracing(); t++) {
+                sim_printf("\nt=%lld: ", t);
+
+                if (running) {
+                    sim_printf("%s executes\n", running->process.ID);
+                    log_print("%s executes\n", running->process.ID);
+                } else if (io_busy) {
+                    sim_printf("CPU idle (IO device busy)\n");
+                    log_print("CPU idle (IO device busy)\n");
+                } else if (ready_waiting) {
+                    sim_printf("CPU idle (processes in ready queue)\n");
+                    log_print("CPU idle (processes in ready queue)\n");
+                } else {
+                    sim_printf("CPU idle\n");
+                    log_print("CPU idle\n");
+                }
+            }
+
+            if (running) {
+                running->remaining_time -= quiet;
+                running->executed_time += quiet;
+                add_gantt_slice(running - pcbs, time + 1, quiet, NULL);
+
+                /* Each tick the best waiting candidate is re-queued at the back. */
+                int ties = ready_queue_ties(readyq);
+                for (int i = 0; ties > 0 && i < quiet % ties; i++) {
+                    make_ready(readyq, pcbs, pick_highest_priority_and_remove(readyq, pcbs, &waits), &waits);
+                }
+            } else {
+                add_gantt_slice(GANTT_IDLE, time + 1, quiet, "#cccccc");
+            }
+
+            update_wait_times(&waits, quiet);
+            time += quiet;
         }
 
         time++;
     }
+    checkpoint_end(&ck);
 
-    printf("\n--- Simulation End at t=%d ---\n", time);
+    sim_printf("\n--- Simulation End at t=%lld ---\n", time);
     log_print("\n--- Priority Preemptive Algorithm Completed ***\n\n");
 
 
-    printf("\nProcess Summary:\n");
-    printf("Process\tWait Time\n");
+    sim_printf("\nProcess Summary:\n");
+    sim_printf("Process\tWait Time\n");
     for (int i = 0; i < count; i++) {
-        printf("%s\t%d\n", pcbs[i].process.ID, pcbs[i].wait_time);
+        sim_printf("%s\t%lld\n", pcbs[i].process.ID, pcbs[i].wait_time);
     }
 
-    while (!is_queue_empty(readyq)) readyq = remove_process_from_queue(readyq);
-    while (!is_queue_empty(ioq)) ioq = remove_process_from_queue(ioq);
+    ready_queue_destroy(readyq);
+    io_timer_destroy(io_timer);
+    free(waits.since);
+    queue_pool_destroy(pool);
 }
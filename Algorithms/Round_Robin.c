@@ -12,152 +12,217 @@
 #include "../Config/types.h"
 #include "../Config/config.h"
 #include "../Utils/Algorithms.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
 #include "../Utils/log_file.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
 
 void RoundRobin_Algo(Config* config, int quantum) {
     clear_gantt_slices();
     PCB* pcb = initialize_PCB(config);
-    int time = 0;
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+    sim_time_t time = 0;
     int finished = 0;
     char line1[2000] = "";
     char line2[2000] = "";
     char line3[2000] = "";
     char line4[2000] = "";
     
-    QUEUE ready_queue ;
-    ready_queue.size = 0;
-    ready_queue.start = NULL;
-    ready_queue.end = NULL; 
-    QUEUE io_queue ;
-    io_queue.size = 0;
-    io_queue.start = NULL;
-    io_queue.end = NULL;
-    printf("Quantum Time set to %d units\n", quantum);
+    ReadyQueue* ready_queue = ready_queue_create(READY_FIFO, config->process_count, 0);
+    /* A single I/O device: each I/O waits for the one armed before it. */
+    IoTimer* io_timer = io_timer_create(config->process_count);
+    sim_time_t io_busy_until = 0;
+    if (!pcb || !ready_queue || !io_timer) {
+        ready_queue_destroy(ready_queue);
+        io_timer_destroy(io_timer);
+        sim_fail("Memory allocation failed in RoundRobin_Algo");
+        return;
+    }
+    sim_printf("Quantum Time set to %d units\n", quantum);
     log_print("Quantum Time set to %d units\n", quantum);
     int used_quantum = 0;
 
-    printf("PCB initialized\n");
+    sim_printf("PCB initialized\n");
+
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &finished, sizeof(finished));
+    checkpoint_add(&ck, &used_quantum, sizeof(used_quantum));
+    checkpoint_add(&ck, &io_busy_until, sizeof(io_busy_until));
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add(&ck, line1, sizeof(line1));
+    checkpoint_add(&ck, line2, sizeof(line2));
+    checkpoint_add(&ck, line3, sizeof(line3));
+    checkpoint_add(&ck, line4, sizeof(line4));
+    checkpoint_add_pcbs(&ck, pcb, config->process_count);
+    ready_queue_checkpoint(ready_queue, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready_queue, NULL);
+    io_timer_checkpoint(io_timer, &ck, &time);
 
     while(finished < config->process_count) {
-        printf("\nTime = %d \n", time);
+        if (checkpoint_step(&ck)) break;
+        sim_printf("\nTime = %lld \n", time);
         
 
-        for (int i = 0; i < config->process_count; i++) {
-            PROCESS p = config->processes[i];
+        int arrived;
+        while ((arrived = arrival_stream_pop(&arrivals, time)) != -1) {
+            PROCESS p = config->processes[arrived];
             
-            if (p.arrival_time == time && !pcb[i].finished && !pcb[i].in_io) { // add to ready queue
-                printf("At time %d: Process %s arrived and added to ready queue\n", time, p.ID);
-                log_print("At time %d: Process %s arrived and added to ready queue\n", time, p.ID);
-                ready_queue = add_process_to_queue(ready_queue, p);
+            if (!pcb[arrived].finished && !pcb[arrived].in_io) { // add to ready queue
+                sim_printf("At time %lld: Process %s arrived and added to ready queue\n", time, p.ID);
+                log_print("At time %lld: Process %s arrived and added to ready queue\n", time, p.ID);
+                ready_queue_push(ready_queue, arrived, 0, 0);
             }
         }
 
         // IO 
-        if (io_queue.size > 0) {
-            PROCESS io_p = io_queue.start->process;
-            
-            for (int i = 0; i < config->process_count; i++) {
-                if (strcmp(pcb[i].process.ID, io_p.ID) == 0 && pcb[i].in_io) {
-                    pcb[i].io_remaining--;
-                    printf("At time %d: Process %s executes its IO and it rest : %d\n", time, io_p.ID, pcb[i].io_remaining);
-                    log_print("At time %d: Process %s executes its IO and it rest : %d\n", time, io_p.ID, pcb[i].io_remaining);
-                    
-                    if (pcb[i].io_remaining <= 0) {
-                        io_queue = remove_process_from_queue(io_queue);
-                        pcb[i].in_io = 0;
-                        pcb[i].io_index++;
-                        printf("At time %d: Process %s finished IO & added back to ready queue\n", time, io_p.ID);
-                        log_print("At time %d: Process %s finished IO & added back to ready queue\n", time, io_p.ID);
-                        ready_queue = add_process_to_queue(ready_queue, io_p);
-                    }
-                    break;
-                }
+        if (io_timer_pending(io_timer) > 0) {
+            int i = io_timer_first(io_timer);
+            PROCESS io_p = pcb[i].process;
+            sim_time_t io_left = io_timer_next(io_timer) - time;
+
+            sim_printf("At time %lld: Process %s executes its IO and it rest : %lld\n", time, io_p.ID, io_left);
+            log_print("At time %lld: Process %s executes its IO and it rest : %lld\n", time, io_p.ID, io_left);
+
+            if (io_timer_pop_due(io_timer, time) != -1) {
+                pcb[i].in_io = 0;
+                pcb[i].io_index++;
+                sim_printf("At time %lld: Process %s finished IO & added back to ready queue\n", time, io_p.ID);
+                log_print("At time %lld: Process %s finished IO & added back to ready queue\n", time, io_p.ID);
+                ready_queue_push(ready_queue, i, 0, 0);
             }
         }
 
 
         int cpu_executed = 0;
-        if (ready_queue.size > 0) {
-            PROCESS p = ready_queue.start->process;
+        if (ready_queue_size(ready_queue) > 0) {
+            int i = ready_queue_peek(ready_queue);
+            PROCESS p = pcb[i].process;
+            pcb[i].executed_time++;
+            pcb[i].remaining_time--;
+            used_quantum++;
+            cpu_executed = 1;
+            add_gantt_slice(i, time, 1, NULL);
+            sim_printf("At time %lld: Process %s executs\n", time, p.ID);
+            log_print("At time %lld: Process %s executs\n", time, p.ID);
+            
+            chart_append(line1, sizeof(line1), "--");
+            chart_append(line2, sizeof(line2), "   ");
+            chart_append(line3, sizeof(line3), "--");
+            chart_append(line4, sizeof(line4), "   ");
             
-            for (int i = 0; i < config->process_count; i++) {
-                if (strcmp(pcb[i].process.ID, p.ID) == 0 && !pcb[i].finished && !pcb[i].in_io) {
-                    
-                    pcb[i].executed_time++;
-                    pcb[i].remaining_time--;
-                    used_quantum++;
-                    cpu_executed = 1;
-                    add_gantt_slice(p.ID, time, 1, NULL);
-                    printf("At time %d: Process %s executs\n", time, p.ID);
-                    log_print("At time %d: Process %s executs\n", time, p.ID);
-                    
-                    strcat(line1, "--");
-                    strcat(line2, "   ");
-                    strcat(line3, "--");
-                    strcat(line4, "   ");
-                    
-                    if (p.io_count > 0 && pcb[i].io_index < p.io_count && pcb[i].executed_time == p.io_operations[pcb[i].io_index].start_time) {
-                        
-                        printf("At time %d: Process %s starts IO\n", time, p.ID);
-                        log_print("At time %d: Process %s starts IO\n", time, p.ID);
-                        add_io_slice(p.ID, time + 1, p.io_operations[pcb[i].io_index].duration, NULL, "I/O");
-                        pcb[i].in_io = 1;
-
-                        pcb[i].io_remaining = p.io_operations[pcb[i].io_index].duration + 1;
-                        ready_queue = remove_process_from_queue(ready_queue);
-                        io_queue = add_process_to_queue(io_queue, p);
-                        used_quantum = 0;
-                        strcat(line2, p.ID);
-                        strcat(line2, "|");
-                        snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4),  "%d", time + 1);
-                    }
-
-                    else if (pcb[i].remaining_time <= 0) {
-                        printf("At time %d: Process %s finishes\n", time, p.ID);
-                        log_print("At time %d: Process %s finishes\n", time, p.ID);
-                        pcb[i].finished = 1;
-                        finished++;
-                        ready_queue = remove_process_from_queue(ready_queue);
-                        used_quantum = 0;
-                        
-                        strcat(line2, p.ID);
-                        strcat(line2, " | ");
-                        snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4), "%d", time + 1);
-                    }
-
-                    else if (used_quantum >= quantum) {
-                        printf("At time %d: Process %s quantum finish\n", time, p.ID);
-                        log_print("At time %d: Process %s quantum finish\n", time, p.ID);
-                        ready_queue = remove_process_from_queue(ready_queue);
-                        ready_queue = add_process_to_queue(ready_queue, p);
-                        used_quantum = 0;
-                        
-                        strcat(line2, p.ID);
-                        strcat(line2, " | ");
-                        snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4), "%d", time + 1);
-                    }
-                    
-                    break;
-                }
+            if (p.io_count > 0 && pcb[i].io_index < p.io_count && pcb[i].executed_time == pcb[i].io_operations[pcb[i].io_index].start_time) {
+                
+                sim_printf("At time %lld: Process %s starts IO\n", time, p.ID);
+                log_print("At time %lld: Process %s starts IO\n", time, p.ID);
+                add_io_slice(i, time + 1, pcb[i].io_operations[pcb[i].io_index].duration, NULL, "I/O");
+                pcb[i].in_io = 1;
+
+                sim_time_t countdown = pcb[i].io_operations[pcb[i].io_index].duration + 1;
+                io_timer_arm(io_timer, i, io_timer_due_serial(time, &io_busy_until, countdown), 0);
+                ready_queue_pop(ready_queue);
+                used_quantum = 0;
+                chart_append(line2, sizeof(line2), p.ID);
+                chart_append(line2, sizeof(line2), "|");
+                snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4),  "%lld", time + 1);
+            }
+
+            else if (pcb[i].remaining_time <= 0) {
+                sim_printf("At time %lld: Process %s finishes\n", time, p.ID);
+                log_print("At time %lld: Process %s finishes\n", time, p.ID);
+                pcb[i].finished = 1;
+                finished++;
+                ready_queue_pop(ready_queue);
+                used_quantum = 0;
+                
+                chart_append(line2, sizeof(line2), p.ID);
+                chart_append(line2, sizeof(line2), " | ");
+                snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4), "%lld", time + 1);
+            }
+
+            else if (used_quantum >= quantum) {
+                sim_printf("At time %lld: Process %s quantum finish\n", time, p.ID);
+                log_print("At time %lld: Process %s quantum finish\n", time, p.ID);
+                ready_queue_pop(ready_queue);
+                ready_queue_push(ready_queue, i, 0, 0);
+                used_quantum = 0;
+                
+                chart_append(line2, sizeof(line2), p.ID);
+                chart_append(line2, sizeof(line2), " | ");
+                snprintf(line4 + strlen(line4), sizeof(line4) - strlen(line4), "%lld", time + 1);
             }
         }
         
 
         if (!cpu_executed) {
-            add_gantt_slice("IDLE", time, 1, "#cccccc");
-            strcat(line1, "--");
-            strcat(line2, "   ");
-            strcat(line3, "--");
-            strcat(line4, "   ");
+            add_gantt_slice(GANTT_IDLE, time, 1, "#cccccc");
+            chart_append(line1, sizeof(line1), "--");
+            chart_append(line2, sizeof(line2), "   ");
+            chart_append(line3, sizeof(line3), "--");
+            chart_append(line4, sizeof(line4), "   ");
         }
-        
+
+        Engine engine;
+        engine_start(&engine, time);
+        engine_schedule_arrival(&engine, &arrivals);
+
+        engine_schedule(&engine, io_timer_next(io_timer));
+        PCB* io_pcb = io_timer_pending(io_timer) > 0 ? &pcb[io_timer_first(io_timer)] : NULL;
+
+        PCB* running = NULL;
+        if (ready_queue_size(ready_queue) > 0) {
+            running = &pcb[ready_queue_peek(ready_queue)];
+            engine_schedule_burst(&engine, running->remaining_time, running->executed_time,
+                                  pcb_next_io(running), 1);
+            engine_schedule_quantum(&engine, used_quantum, quantum);
+        }
+
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        for (sim_time_t k = 1; k <= quiet && sim_tracing(); k++) {
+            sim_time_t t = time + k;
+            sim_printf("\nTime = %lld \n", t);
+
+            if (io_pcb) {
+                sim_printf("At time %lld: Process %s executes its IO and it rest : %lld\n", t, io_pcb->process.ID, io_timer_next(io_timer) - t);
+                log_print("At time %lld: Process %s executes its IO and it rest : %lld\n", t, io_pcb->process.ID, io_timer_next(io_timer) - t);
+            }
+
+            if (running) {
+                sim_printf("At time %lld: Process %s executs\n", t, running->process.ID);
+                log_print("At time %lld: Process %s executs\n", t, running->process.ID);
+            }
+        }
+
+        if (quiet > 0) {
+            chart_repeat(line1, sizeof(line1), "--", quiet);
+            chart_repeat(line2, sizeof(line2), "   ", quiet);
+            chart_repeat(line3, sizeof(line3), "--", quiet);
+            chart_repeat(line4, sizeof(line4), "   ", quiet);
+
+            if (running) {
+                running->executed_time += quiet;
+                running->remaining_time -= quiet;
+                used_quantum += quiet;
+                add_gantt_slice(running - pcb, time + 1, quiet, NULL);
+            } else {
+                add_gantt_slice(GANTT_IDLE, time + 1, quiet, "#cccccc");
+            }
+            time += quiet;
+        }
+
         time++;
     }
+    checkpoint_end(&ck);
+    ready_queue_destroy(ready_queue);
+    io_timer_destroy(io_timer);
     log_print("*** Round Robin Algorithm Completed ***\n\n");
-    printf("\nGantt Chart \n");
-    printf("%s\n", line1);
-    printf("%s\n", line2);
-    printf("%s\n", line3);
-    printf("%s\n", line4);
+    sim_printf("\nGantt Chart \n");
+    sim_printf("%s\n", line1);
+    sim_printf("%s\n", line2);
+    sim_printf("%s\n", line3);
+    sim_printf("%s\n", line4);
 }
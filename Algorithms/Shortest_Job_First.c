@@ -11,33 +11,25 @@
 #include "../Config/config.h"
 #include "../Utils/Algorithms.h"
 #include "../Utils/log_file.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/checkpoint.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 
 
-PROCESS select_SJF(QUEUE queue) {
-    QueueNode *node = queue.start;
-    PROCESS minP = node->process;
-
-    while (node != NULL) {
-        if (node->process.execution_time < minP.execution_time) {
-            minP = node->process;
-        }
-        node = node->next;
-    }
-    return minP;
-}
-
-
 void SJF_Algo(Config *config) {
     clear_gantt_slices();
     clear_io_slices();
 
     PCB *pcb = initialize_PCB(config);
-    int time = 0;
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+    sim_time_t time = 0;
     int finished = 0;
 
 
@@ -46,147 +38,206 @@ void SJF_Algo(Config *config) {
     char line3[2000] = "";
     char line4[2000] = "";
 
-    QUEUE ready_queue = {NULL, NULL, 0};
-    QUEUE io_queue = {NULL, NULL, 0};
+    ReadyQueue *ready_queue = ready_queue_create(READY_SCAN, config->process_count, 0);
+    /* A single I/O device: each I/O waits for the one armed before it. */
+    IoTimer *io_timer = io_timer_create(config->process_count);
+    sim_time_t io_busy_until = 0;
+    if (!pcb || !ready_queue || !io_timer) {
+        ready_queue_destroy(ready_queue);
+        io_timer_destroy(io_timer);
+        sim_fail("Memory allocation failed in SJF_Algo");
+        return;
+    }
 
-    printf("SJF simulation start\n");
+    sim_printf("SJF simulation start\n");
 
-    PROCESS current;
+    int current_index = -1;
     int cpu_busy = 0;
 
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &time);
+    checkpoint_add(&ck, &finished, sizeof(finished));
+    checkpoint_add(&ck, &current_index, sizeof(current_index));
+    checkpoint_add(&ck, &cpu_busy, sizeof(cpu_busy));
+    checkpoint_add(&ck, &io_busy_until, sizeof(io_busy_until));
+    checkpoint_add_arrivals(&ck, &arrivals);
+    checkpoint_add(&ck, line1, sizeof(line1));
+    checkpoint_add(&ck, line2, sizeof(line2));
+    checkpoint_add(&ck, line3, sizeof(line3));
+    checkpoint_add(&ck, line4, sizeof(line4));
+    checkpoint_add_pcbs(&ck, pcb, config->process_count);
+    ready_queue_checkpoint(ready_queue, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready_queue, NULL);
+    io_timer_checkpoint(io_timer, &ck, &time);
+
     while (finished < config->process_count) {
+        if (checkpoint_step(&ck)) break;
 
-        printf("\nTime = %d\n", time);
-        log_print("\nTime = %d\n", time);
+        sim_printf("\nTime = %lld\n", time);
+        log_print("\nTime = %lld\n", time);
 
 
-        for (int i = 0; i < config->process_count; i++) {
-            PROCESS p = config->processes[i];
+        int arrived;
+        while ((arrived = arrival_stream_pop(&arrivals, time)) != -1) {
+            PROCESS p = config->processes[arrived];
 
-            if (p.arrival_time == time && !pcb[i].finished && !pcb[i].in_io) {
-                printf("At time %d: Process %s arrived\n", time, p.ID);
-                log_print("At time %d: Process %s arrived\n", time, p.ID);
-                ready_queue = add_process_to_queue(ready_queue, p);
+            if (!pcb[arrived].finished && !pcb[arrived].in_io) {
+                sim_printf("At time %lld: Process %s arrived\n", time, p.ID);
+                log_print("At time %lld: Process %s arrived\n", time, p.ID);
+                ready_queue_push(ready_queue, arrived, p.execution_time, 0);
             }
         }
 
 
-        if (io_queue.size > 0) {
-            PROCESS io_p = io_queue.start->process;
+        if (io_timer_pending(io_timer) > 0) {
+            int i = io_timer_first(io_timer);
+            PROCESS io_p = pcb[i].process;
+            sim_time_t io_left = io_timer_next(io_timer) - time;
 
-            for (int i = 0; i < config->process_count; i++) {
-                if (strcmp(io_p.ID, pcb[i].process.ID) == 0 && pcb[i].in_io) {
+            sim_printf("At time %lld: Process %s executes IO (%lld left)\n", time, io_p.ID, io_left);
+            log_print("At time %lld: Process %s executes IO (%lld left)\n", time, io_p.ID, io_left);
 
+            if (io_timer_pop_due(io_timer, time) != -1) {
+                sim_printf("At time %lld: Process %s IO finished\n", time, io_p.ID);
+                log_print("At time %lld: Process %s IO finished\n", time, io_p.ID);
 
-                    if (pcb[i].io_remaining > 0) {
-                        pcb[i].io_remaining--;
+                pcb[i].in_io = 0;
+                pcb[i].io_index++;
 
-                        printf("At time %d: Process %s executes IO (%d left)\n", time, io_p.ID, pcb[i].io_remaining);
-                        log_print("At time %d: Process %s executes IO (%d left)\n", time, io_p.ID, pcb[i].io_remaining);
-
-                        if (pcb[i].io_remaining == 0) {
-                            printf("At time %d: Process %s IO finished\n", time, io_p.ID);
-                            log_print("At time %d: Process %s IO finished\n", time, io_p.ID);
-
-                            pcb[i].in_io = 0;
-                            pcb[i].io_index++;
-
-                            io_queue = remove_specific_process(io_queue, io_p.ID);
-                            ready_queue = add_process_to_queue(ready_queue, io_p);
-                        }
-                    }
-                    break;
-                }
+                ready_queue_push(ready_queue, i, io_p.execution_time, 0);
             }
         }
 
-        if (!cpu_busy && ready_queue.size > 0) {
-            current = select_SJF(ready_queue);
+        if (!cpu_busy && ready_queue_size(ready_queue) > 0) {
+            current_index = ready_queue_pop(ready_queue);
             cpu_busy = 1;
-            printf("At time %d: CPU selects %s (SJF)\n", time, current.ID);
-            log_print("At time %d: CPU selects %s (SJF)\n", time, current.ID);
+            sim_printf("At time %lld: CPU selects %s (SJF)\n", time, pcb[current_index].process.ID);
+            log_print("At time %lld: CPU selects %s (SJF)\n", time, pcb[current_index].process.ID);
         }
 
         int cpu_executed = 0;
 
         if (cpu_busy) {
-            for (int i = 0; i < config->process_count; i++) {
-                if (strcmp(current.ID, pcb[i].process.ID) == 0 &&
-                    !pcb[i].finished &&
-                    !pcb[i].in_io) {
+            int i = current_index;
+            const PROCESS *current = &pcb[i].process;
+            pcb[i].remaining_time--;
+            pcb[i].executed_time++;
+            cpu_executed = 1;
 
-                    pcb[i].remaining_time--;
-                    pcb[i].executed_time++;
-                    cpu_executed = 1;
+            sim_printf("At time %lld: %s executes\n", time, current->ID);
+            log_print("At time %lld: %s executes\n", time, current->ID);
 
-                    printf("At time %d: %s executes\n", time, current.ID);
-                    log_print("At time %d: %s executes\n", time, current.ID);
+            add_gantt_slice(i, time, 1, NULL);
 
-                    add_gantt_slice(current.ID, time, 1, NULL);
+            chart_append(line1, sizeof(line1), "--");
+            chart_append(line2, sizeof(line2), current->ID);
+            chart_append(line2, sizeof(line2), " ");
+            chart_append(line3, sizeof(line3), "--");
+            chart_append(line4, sizeof(line4), "   ");
 
-                    strcat(line1, "--");
-                    strcat(line2, current.ID);
-                    strcat(line2, " ");
-                    strcat(line3, "--");
-                    strcat(line4, "   ");
+            if (pcb[i].remaining_time <= 0) {
+                sim_printf("At time %lld: %s finishes\n", time, current->ID);
+                log_print("At time %lld: %s finishes\n", time, current->ID);
 
-                    if (pcb[i].remaining_time <= 0) {
-                        printf("At time %d: %s finishes\n", time, current.ID);
-                        log_print("At time %d: %s finishes\n", time, current.ID);
+                pcb[i].finished = 1;
+                finished++;
 
-                        pcb[i].finished = 1;
-                        finished++;
+                cpu_busy = 0;
+            } else if (current->io_count > 0 &&
+                       pcb[i].io_index < current->io_count &&
+                       pcb[i].executed_time ==
+                           pcb[i].io_operations[pcb[i].io_index].start_time) {
 
-                        ready_queue = remove_specific_process(ready_queue, current.ID);
-                        cpu_busy = 0;
-                        break;
-                    }
+                sim_printf("At time %lld: %s starts IO\n", time + 1, current->ID);
+                log_print("At time %lld: %s starts IO\n", time + 1, current->ID);
+                
+                add_io_slice(i, time + 1,
+                    pcb[i].io_operations[pcb[i].io_index].duration,
+                    NULL, "I/O");
 
-                    if (current.io_count > 0 &&
-                        pcb[i].io_index < current.io_count &&
-                        pcb[i].executed_time ==
-                            current.io_operations[pcb[i].io_index].start_time) {
+                pcb[i].in_io = 1;
 
-                        printf("At time %d: %s starts IO\n", time + 1, current.ID);
-                        log_print("At time %d: %s starts IO\n", time + 1, current.ID);
-                        
-                        add_io_slice(current.ID, time + 1,
-                            current.io_operations[pcb[i].io_index].duration,
-                            NULL, "I/O");
+                sim_time_t countdown = pcb[i].io_operations[pcb[i].io_index].duration + 1;
+                io_timer_arm(io_timer, i, io_timer_due_serial(time, &io_busy_until, countdown), 0);
 
-                        pcb[i].in_io = 1;
+                cpu_busy = 0;
+            }
+        }
 
-                        pcb[i].io_remaining = current.io_operations[pcb[i].io_index].duration + 1;
+        if (!cpu_executed) {
+            add_gantt_slice(GANTT_IDLE, time, 1, "#cccccc");
 
-                        ready_queue = remove_specific_process(ready_queue, current.ID);
-                        io_queue = add_process_to_queue(io_queue, current);
+            chart_append(line1, sizeof(line1), "--");
+            chart_append(line2, sizeof(line2), "   ");
+            chart_append(line3, sizeof(line3), "--");
+            chart_append(line4, sizeof(line4), "   ");
+        }
 
-                        cpu_busy = 0;
-                        break;
-                    }
+        Engine engine;
+        engine_start(&engine, time);
+        engine_schedule_arrival(&engine, &arrivals);
 
-                    break;
-                }
-            }
+        engine_schedule(&engine, io_timer_next(io_timer));
+        PCB *io_pcb = io_timer_pending(io_timer) > 0 ? &pcb[io_timer_first(io_timer)] : NULL;
+
+        PCB *running = NULL;
+        if (cpu_busy) {
+            running = &pcb[current_index];
+            engine_schedule_burst(&engine, running->remaining_time, running->executed_time,
+                                  pcb_next_io(running), 1);
+        } else if (ready_queue_size(ready_queue) > 0) {
+            engine_schedule(&engine, time + 1);
         }
 
-        if (!cpu_executed) {
-            add_gantt_slice("IDLE", time, 1, "#cccccc");
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        for (sim_time_t k = 1; k <= quiet && sim_tracing(); k++) {
+            sim_time_t t = time + k;
+            sim_printf("\nTime = %lld\n", t);
+            log_print("\nTime = %lld\n", t);
+
+            if (io_pcb) {
+                sim_printf("At time %lld: Process %s executes IO (%lld left)\n", t, io_pcb->process.ID, io_timer_next(io_timer) - t);
+                log_print("At time %lld: Process %s executes IO (%lld left)\n", t, io_pcb->process.ID, io_timer_next(io_timer) - t);
+            }
+
+            if (running) {
+                sim_printf("At time %lld: %s executes\n", t, running->process.ID);
+                log_print("At time %lld: %s executes\n", t, running->process.ID);
+            }
+        }
 
-            strcat(line1, "--");
-            strcat(line2, "   ");
-            strcat(line3, "--");
-            strcat(line4, "   ");
+        if (quiet > 0) {
+            chart_repeat(line1, sizeof(line1), "--", quiet);
+            chart_repeat(line3, sizeof(line3), "--", quiet);
+            chart_repeat(line4, sizeof(line4), "   ", quiet);
+            if (running) {
+                char cell[sizeof(line2)];
+                snprintf(cell, sizeof(cell), "%s ", running->process.ID);
+                chart_repeat(line2, sizeof(line2), cell, quiet);
+
+                running->remaining_time -= quiet;
+                running->executed_time += quiet;
+                add_gantt_slice(current_index, time + 1, quiet, NULL);
+            } else {
+                chart_repeat(line2, sizeof(line2), "   ", quiet);
+                add_gantt_slice(GANTT_IDLE, time + 1, quiet, "#cccccc");
+            }
+            time += quiet;
         }
 
         time++;
     }
+    checkpoint_end(&ck);
     
+    ready_queue_destroy(ready_queue);
+    io_timer_destroy(io_timer);
+
     log_print("\n***SJF Algorithm Completed ***\n");
     
-    printf("\nGantt Chart\n");
-    printf("%s\n", line1);
-    printf("%s\n", line2);
-    printf("%s\n", line3);
-    printf("%s\n", line4);
+    sim_printf("\nGantt Chart\n");
+    sim_printf("%s\n", line1);
+    sim_printf("%s\n", line2);
+    sim_printf("%s\n", line3);
+    sim_printf("%s\n", line4);
 }
\ No newline at end of file
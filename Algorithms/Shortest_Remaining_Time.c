@@ -13,8 +13,12 @@
 #include "../Utils/log_file.h"
 #include "../Config/config.h"
 #include "../Config/types.h"
-#include "../Interface/gantt_chart.h"
-#include "../Interface/gantt_chart.h"
+#include "../Utils/sim_context.h"
+#include "../Utils/engine.h"
+#include "../Utils/ready_queue.h"
+#include "../Utils/io_timer.h"
+#include "../Utils/process_state.h"
+#include "../Utils/checkpoint.h"
 
 void SRT_Algo(Config* config) {
     clear_gantt_slices();
@@ -22,151 +26,184 @@ void SRT_Algo(Config* config) {
     
     int n = config->process_count;
     if (n <= 0) {
-        printf("No processes to schedule.\n");
+        sim_printf("No processes to schedule.\n");
         return;
     }
 
-    int *remaining = malloc(sizeof(int) * n);
-    int *executed = malloc(sizeof(int) * n);
-    int *next_io = malloc(sizeof(int) * n);
-    int *blocked = malloc(sizeof(int) * n);
-    int *finished = malloc(sizeof(int) * n);
-    int *started = malloc(sizeof(int) * n);
-    int *start_time = malloc(sizeof(int) * n);
-    int *end_time = malloc(sizeof(int) * n);
-    int *response_time = malloc(sizeof(int) * n);
-    int *io_started_this_tick = malloc(sizeof(int) * n);
-
-    if (!remaining || !executed || !next_io || !blocked || !finished ||
-        !started || !start_time || !end_time || !response_time || !io_started_this_tick) {
-        fprintf(stderr, "Memory allocation failed in SRT_Algo\n");
-        exit(1);
+    ProcessState *state = process_state_create(config);
+    if (state == NULL) {
+        sim_fail("Memory allocation failed in SRT_Algo");
+        return;
     }
-
-    int total_exec = 0;
-    int total_io = 0;
-    for (int i = 0; i < n; ++i) {
-        remaining[i] = config->processes[i].execution_time;
-        executed[i] = 0;
-        next_io[i] = 0;
-        blocked[i] = 0;
-        finished[i] = 0;
-        started[i] = 0;
-        start_time[i] = -1;
-        end_time[i] = -1;
-        response_time[i] = -1;
-        io_started_this_tick[i] = 0;
-        total_exec += config->processes[i].execution_time;
-        for (int j = 0; j < config->processes[i].io_count; ++j)
-            total_io += config->processes[i].io_operations[j].duration;
+    sim_time_t *remaining = state->remaining;
+    sim_time_t *executed = state->executed;
+    int *next_io = state->next_io;
+    int *finished = state->finished;
+    int *started = state->started;
+    sim_time_t *start_time = state->start_time;
+    sim_time_t *end_time = state->end_time;
+    sim_time_t *response_time = state->response_time;
+
+    ReadyQueue *ready = ready_queue_create(READY_SCAN, n, 0);
+    IoTimer *io_timer = io_timer_create(n);
+    if (!ready || !io_timer) {
+        ready_queue_destroy(ready);
+        io_timer_destroy(io_timer);
+        process_state_destroy(state);
+        sim_fail("Memory allocation failed in SRT_Algo");
+        return;
     }
+    ArrivalStream arrivals;
+    arrival_stream_start(&arrivals, config);
+    arrival_stream_ranks(&arrivals, state->arrival_rank);
 
-    int max_ticks = total_exec + total_io + 1000;
     int processes_left = n;
-    int tick = 0;
-
-    printf("=== Running SRT Algorithm (preemptive) with I/O ===\n");
-
-    while (processes_left > 0 && tick < max_ticks) {
-        for (int i = 0; i < n; ++i) {
-            if (blocked[i] > 0 && !io_started_this_tick[i]) {
-                blocked[i]--;
-                if (blocked[i] == 0) {
-                    printf("Time %d: Process %s finished I/O and is READY again (remaining %d)\n", 
-                           tick, config->processes[i].ID, remaining[i]);
-                    log_print("Time %d: Process %s finished I/O and is READY again (remaining %d)\n", 
-                             tick, config->processes[i].ID, remaining[i]);
-                }
-            }
-            io_started_this_tick[i] = 0; 
+    sim_time_t tick = 0;
+
+    sim_printf("=== Running SRT Algorithm (preemptive) with I/O ===\n");
+
+    Checkpoint ck;
+    checkpoint_begin(&ck);
+    checkpoint_add_clock(&ck, &tick);
+    checkpoint_add(&ck, &processes_left, sizeof(processes_left));
+    checkpoint_add_arrivals(&ck, &arrivals);
+    process_state_checkpoint(state, &ck);
+    ready_queue_checkpoint(ready, &ck);
+    checkpoint_add_queue(&ck, "ready", CHECKPOINT_QUEUE_READY, ready, NULL);
+    io_timer_checkpoint(io_timer, &ck, &tick);
+
+    while (processes_left > 0) {
+        if (checkpoint_step(&ck)) break;
+        int i;
+        while ((i = io_timer_pop_due(io_timer, tick)) != -1) {
+            sim_printf("Time %lld: Process %s finished I/O and is READY again (remaining %lld)\n", 
+                   tick, config->processes[i].ID, remaining[i]);
+            log_print("Time %lld: Process %s finished I/O and is READY again (remaining %lld)\n", 
+                     tick, config->processes[i].ID, remaining[i]);
+            ready_queue_push(ready, i, remaining[i],
+                             state->arrival_rank[i]);
         }
 
-        int shortest = -1;
-        for (int i = 0; i < n; ++i) {
-            if (finished[i]) continue;
-            if (blocked[i] > 0) continue;
-            if (config->processes[i].arrival_time > tick) continue;
-            if (remaining[i] <= 0) continue;
-
-            if (shortest == -1
-                || remaining[i] < remaining[shortest]
-                || (remaining[i] == remaining[shortest] && 
-                    config->processes[i].arrival_time < config->processes[shortest].arrival_time)) {
-                shortest = i;
-            }
+        while ((i = arrival_stream_pop(&arrivals, tick)) != -1) {
+            /* As in the other algorithms, a process with nothing to run still takes a tick. */
+            ready_queue_push(ready, i, remaining[i],
+                             state->arrival_rank[i]);
         }
 
+        int shortest = ready_queue_peek(ready);
+
+        int still_running = 0;
+
         if (shortest == -1) {
-            printf("Time %d: CPU idle\n", tick);
-            log_print("Time %d: CPU idle\n", tick);
-            add_gantt_slice("IDLE", tick, 1, "#cccccc");
-            tick++;
-            continue;
+            sim_printf("Time %lld: CPU idle\n", tick);
+            log_print("Time %lld: CPU idle\n", tick);
+            add_gantt_slice(GANTT_IDLE, tick, 1, "#cccccc");
+        } else {
+            PROCESS *p = &config->processes[shortest];
+
+            if (!started[shortest]) {
+                started[shortest] = 1;
+                start_time[shortest] = tick;
+                response_time[shortest] = tick - p->arrival_time;
+            }
+
+            sim_printf("Time %lld: Running %s (Remaining %lld)\n", tick, p->ID, remaining[shortest]);
+            log_print("Time %lld: Running %s (Remaining %lld)\n", tick, p->ID, remaining[shortest]);
+            
+            add_gantt_slice(shortest, tick, 1, NULL);
+            
+            remaining[shortest]--;
+            executed[shortest]++;
+            still_running = 1;
+
+            if (remaining[shortest] <= 0) {
+                finished[shortest] = 1;
+                end_time[shortest] = tick + 1;
+                processes_left--;
+                still_running = 0;
+                ready_queue_remove(ready, shortest);
+                sim_printf("Time %lld: Process %s FINISHED\n", tick + 1, p->ID);
+                log_print("Time %lld: Process %s FINISHED\n", tick + 1, p->ID);
+            } else if (next_io[shortest] < p->io_count) {
+                IO_OPERATION *io = &process_io(config, p)[next_io[shortest]];
+                
+                if (executed[shortest] == io->start_time) {
+                    next_io[shortest]++;
+                    still_running = 0;
+                    if (io->duration > 0) {
+                        ready_queue_remove(ready, shortest);
+                        /* The I/O countdown only starts on the tick after it is issued. */
+                        io_timer_arm(io_timer, shortest, io_timer_due(tick, io->duration + 1), shortest);
+                    }
+                    
+                    add_io_slice(shortest, tick + 1, io->duration, NULL, "I/O");
+                    
+                    sim_printf("Time %lld: Process %s goes to I/O for %lld ticks\n", 
+                           tick + 1, p->ID, io->duration);
+                    log_print("Time %lld: Process %s goes to I/O for %lld ticks\n", 
+                             tick + 1, p->ID, io->duration);
+                }
+            }
         }
 
-        PROCESS *p = &config->processes[shortest];
+        if (shortest != -1)
+            ready_queue_update(ready, shortest, remaining[shortest]);
 
-        if (!started[shortest]) {
-            started[shortest] = 1;
-            start_time[shortest] = tick;
-            response_time[shortest] = tick - p->arrival_time;
-        }
+        Engine engine;
+        engine_start(&engine, tick);
+        engine_schedule_arrival(&engine, &arrivals);
+
+        engine_schedule(&engine, io_timer_next(io_timer));
 
-        printf("Time %d: Running %s (Remaining %d)\n", tick, p->ID, remaining[shortest]);
-        log_print("Time %d: Running %s (Remaining %d)\n", tick, p->ID, remaining[shortest]);
-        
-        add_gantt_slice(p->ID, tick, 1, NULL);
-        
-        remaining[shortest]--;
-        executed[shortest]++;
-
-        if (remaining[shortest] <= 0) {
-            finished[shortest] = 1;
-            end_time[shortest] = tick + 1;
-            processes_left--;
-            printf("Time %d: Process %s FINISHED\n", tick + 1, p->ID);
-            log_print("Time %d: Process %s FINISHED\n", tick + 1, p->ID);
-            tick++;
-            continue;
+        if (still_running) {
+            PROCESS *p = &config->processes[shortest];
+            const IO_OPERATION *io = next_io[shortest] < p->io_count ? &process_io(config, p)[next_io[shortest]] : NULL;
+            engine_schedule_burst(&engine, remaining[shortest], executed[shortest], io, 1);
+        } else if (shortest != -1) {
+            engine_schedule(&engine, tick + 1);
         }
 
-        if (next_io[shortest] < p->io_count) {
-            IO_OPERATION *io = &p->io_operations[next_io[shortest]];
-            
-            if (executed[shortest] == io->start_time) {
-                blocked[shortest] = io->duration;
-                next_io[shortest]++;
-                io_started_this_tick[shortest] = 1; 
-                
-                add_io_slice(p->ID, tick + 1, io->duration, NULL, "I/O");
-                
-                printf("Time %d: Process %s goes to I/O for %d ticks\n", 
-                       tick + 1, p->ID, io->duration);
-                log_print("Time %d: Process %s goes to I/O for %d ticks\n", 
-                         tick + 1, p->ID, io->duration);
+        sim_time_t quiet = engine_quiet_ticks(&engine);
+        if (quiet > 0) {
+            for (sim_time_t k = 0; k < quiet && sim_tracing(); k++) {
+                sim_time_t t = tick + 1 + k;
+                if (still_running) {
+                    sim_printf("Time %lld: Running %s (Remaining %lld)\n", t, config->processes[shortest].ID, remaining[shortest] - k);
+                    log_print("Time %lld: Running %s (Remaining %lld)\n", t, config->processes[shortest].ID, remaining[shortest] - k);
+                } else {
+                    sim_printf("Time %lld: CPU idle\n", t);
+                    log_print("Time %lld: CPU idle\n", t);
+                }
+            }
+
+            if (still_running) {
+                remaining[shortest] -= quiet;
+                executed[shortest] += quiet;
+                add_gantt_slice(shortest, tick + 1, quiet, NULL);
+                ready_queue_update(ready, shortest, remaining[shortest]);
+            } else {
+                add_gantt_slice(GANTT_IDLE, tick + 1, quiet, "#cccccc");
             }
+
+            tick += quiet;
         }
 
         tick++;
     }
+    checkpoint_end(&ck);
 
-    if (tick >= max_ticks) {
-        printf("Error: Simulation exceeded time limit (max_ticks=%d).\n", max_ticks);
-        log_print("Error: Simulation exceeded time limit (max_ticks=%d).\n", max_ticks);
-    }
-
-    printf("\n=== SRT Final Results ===\n");
-    printf("Process  Arrival  Burst  Completion  Turnaround  Waiting  Response\n");
+    sim_printf("\n=== SRT Final Results ===\n");
+    sim_printf("Process  Arrival  Burst  Completion  Turnaround  Waiting  Response\n");
     double sum_turn=0.0, sum_wait=0.0, sum_resp=0.0;
     for (int i = 0; i < n; ++i) {
-        int arrival = config->processes[i].arrival_time;
-        int burst = config->processes[i].execution_time;
-        int comp = end_time[i] >= 0 ? end_time[i] : 0;
-        int turnaround = (end_time[i] >= 0) ? (end_time[i] - arrival) : 0;
-        int waiting = (turnaround > 0) ? (turnaround - burst) : 0;
-        int resp = (response_time[i] >= 0) ? response_time[i] : -1;
-
-        printf("%-8s %-7d %-6d %-10d %-11d %-8d %-8d\n",
+        sim_time_t arrival = config->processes[i].arrival_time;
+        sim_time_t burst = config->processes[i].execution_time;
+        sim_time_t comp = end_time[i] >= 0 ? end_time[i] : 0;
+        sim_time_t turnaround = (end_time[i] >= 0) ? (end_time[i] - arrival) : 0;
+        sim_time_t waiting = (turnaround > 0) ? (turnaround - burst) : 0;
+        sim_time_t resp = (response_time[i] >= 0) ? response_time[i] : -1;
+
+        sim_printf("%-8s %-7lld %-6lld %-10lld %-11lld %-8lld %-8lld\n",
                config->processes[i].ID, arrival, burst, comp, turnaround, waiting, resp);
 
         sum_turn += turnaround;
@@ -178,21 +215,14 @@ void SRT_Algo(Config* config) {
     double avg_wait = sum_wait / n;
     double avg_resp = sum_resp / n;
 
-    printf("\n*** Short Remaining Time Finished ***\n");
+    sim_printf("\n*** Short Remaining Time Finished ***\n");
     log_print("\n*** Short Remaining Time Finished ***\n");
 
-    printf("\nAverage Turnaround Time: %.2f\n", avg_turn);
-    printf("Average Waiting Time: %.2f\n", avg_wait);
-    printf("Average Response Time: %.2f\n", avg_resp);
-
-    free(remaining);
-    free(executed);
-    free(next_io);
-    free(blocked);
-    free(finished);
-    free(started);
-    free(start_time);
-    free(end_time);
-    free(response_time);
-    free(io_started_this_tick);
+    sim_printf("\nAverage Turnaround Time: %.2f\n", avg_turn);
+    sim_printf("Average Waiting Time: %.2f\n", avg_wait);
+    sim_printf("Average Response Time: %.2f\n", avg_resp);
+
+    ready_queue_destroy(ready);
+    io_timer_destroy(io_timer);
+    process_state_destroy(state);
 }
\ No newline at end of file
@@ -1,149 +1,457 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
- 
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include "config.h"
-#include "types.h"
-
-void trim(char* s) {
-    char *start = s;
-    while(*start == ' ' || *start == '\t' || *start == '\n' || *start == '\r')
-        start++;
-    memmove(s, start, strlen(start)+1); 
-
-
-    char* end = s + strlen(s) - 1;
-    while(end > s && (*end==' ' || *end=='\t' || *end=='\n' || *end=='\r'))
-        *end-- = '\0';
-}
-
-int load_config(char* path , Config* cfg) {
-    FILE* file;
-    if ((file = fopen(path, "r")) == NULL) {
-        perror("fopen()");
-        return 0;
-    } 
-    
-    
-    char line[256];
-    int process = -1;
-    int p_io=-1;
-
-    while(fgets(line, sizeof(line), file)) {
-
-        trim(line);
-        if (line[0] == '#' || strlen(line) ==0 ) {
-            continue;
-        } 
-        
-        
-        if (line[0] == '[') {
-            char section[20]; 
-            sscanf(line, "[%[^]]]", section);
-            
-            
-            if (strncmp(section, "process",7)==0 && strchr(section, '_')==NULL){
-                sscanf( section, "process%d", &process);
-                p_io=-1;
-            }
-            
-            else if (strncmp(section, "process_io",10)==0 && strchr(section, '_')!=NULL){
-                sscanf( section, "process%d_io%d", &process, &p_io);
-                p_io++;
-                
-            }
-            continue;
-        }
-
-        char* eq = strchr(line, '=');
-        if (eq != NULL) {
-            *eq = '\0';
-            char* key = line;
-            char* value = eq + 1;
-
-            
-            trim(key);
-            trim(value);
-            
-            if (strcmp(key, "process_count") == 0) {
-                cfg ->process_count = atoi(value);
-                continue;
-            }
-
-            
-            if(p_io == -1){
-                if (strcmp(key , "ID")==0){
-                    strcpy(cfg -> processes[process].ID , value);
-                }
-                else if (strcmp(key , "arrival_time")==0){
-                    cfg -> processes[process].arrival_time = atoi(value);
-                }
-                else if (strcmp(key , "execution_time")==0){
-                    cfg -> processes[process].execution_time = atoi(value);
-                }
-                else if (strcmp(key , "priority")==0){
-                    cfg -> processes[process].priority = atoi(value);
-                }
-                else if (strcmp(key , "io_count")==0){
-                    cfg -> processes[process].io_count = atoi(value);
-                }
-            }
-
-
-            else {
-                
-            printf("Key: '%s', Value: '%s' p_io :'%d'\n", key, value,p_io);
-                if (strcmp(key , "start_time")==0){
-                    cfg -> processes[process].io_operations[p_io].start_time = atoi(value);
-                }
-                else if (strcmp(key , "duration")==0){
-                    cfg -> processes[process].io_operations[p_io].duration = atoi(value);
-                }
-            }
-
-        } 
-    }
-    fclose(file);
-    return 1;
-}
-void free_config(Config *cfg)
-{
-    if (!cfg) return;
-    free(cfg);
-}
-
-int save_config(char* path, Config* cfg) {
-    if (!path || !cfg) return 0;
-
-    FILE *file = fopen(path, "w");
-    if (!file) return 0;
-
-    fprintf(file, "#config file\n\n");
-    fprintf(file, "process_count = %d\n\n", cfg->process_count);
-
-    for (int i = 0; i < cfg->process_count; i++) {
-        PROCESS *p = &cfg->processes[i];
-        fprintf(file, "[process%d]\n", i);
-        fprintf(file, "ID = %s\n", p->ID);
-        fprintf(file, "arrival_time = %d\n", p->arrival_time);
-        fprintf(file, "execution_time = %d\n", p->execution_time);
-        fprintf(file, "priority = %d\n", p->priority);
-        fprintf(file, "io_count = %d\n\n", p->io_count);
-
-        for (int j = 0; j < p->io_count; j++) {
-            fprintf(file, "[process%d_io%d]\n", i, j);
-            fprintf(file, "start_time = %d\n", p->io_operations[j].start_time);
-            fprintf(file, "duration = %d\n\n", p->io_operations[j].duration);
-        }
-    }
-
-    fclose(file);
-    return 1;
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+ 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "config.h"
+#include "types.h"
+
+void trim(char* s) {
+    char *start = s;
+    while(*start == ' ' || *start == '\t' || *start == '\n' || *start == '\r')
+        start++;
+    memmove(s, start, strlen(start)+1); 
+
+
+    char* end = s + strlen(s) - 1;
+    while(end > s && (*end==' ' || *end=='\t' || *end=='\n' || *end=='\r'))
+        *end-- = '\0';
+}
+
+int config_reserve(Config* cfg, int count) {
+    if (count <= cfg->capacity) return 1;
+
+    int capacity = cfg->capacity > 0 ? cfg->capacity : 16;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+
+    char* block = calloc(capacity, sizeof(PROCESS) + sizeof(PCB) + sizeof(int));
+    if (block == NULL) {
+        fprintf(stderr, "Memory allocation failed for %d processes\n", count);
+        return 0;
+    }
+
+    PROCESS* processes = (PROCESS*)block;
+    PCB* pcbs = (PCB*)(block + capacity * sizeof(PROCESS));
+    int* arrival_order = (int*)(block + capacity * (sizeof(PROCESS) + sizeof(PCB)));
+    if (cfg->processes) {
+        memcpy(processes, cfg->processes, cfg->capacity * sizeof(PROCESS));
+        memcpy(pcbs, cfg->pcbs, cfg->capacity * sizeof(PCB));
+        memcpy(arrival_order, cfg->arrival_order, cfg->capacity * sizeof(int));
+        free(cfg->processes);
+    }
+
+    cfg->processes = processes;
+    cfg->pcbs = pcbs;
+    cfg->arrival_order = arrival_order;
+    cfg->capacity = capacity;
+    return 1;
+}
+
+PROCESS* config_add_process(Config* cfg) {
+    if (!config_reserve(cfg, cfg->process_count + 1)) return NULL;
+
+    PROCESS* p = &cfg->processes[cfg->process_count++];
+    memset(p, 0, sizeof(PROCESS));
+    if (!config_set_id(cfg, cfg->process_count - 1, "")) {
+        cfg->process_count--;
+        return NULL;
+    }
+    return p;
+}
+
+/* Points the IDs found in from at the same strings in to. */
+static void rebase_ids(PROCESS* processes, int count, const char* from, char* to) {
+    for (int i = 0; i < count; i++) {
+        if (processes[i].ID) processes[i].ID = to + (processes[i].ID - from);
+    }
+}
+
+static int id_pool_reserve(Config* cfg, int size) {
+    if (size <= cfg->id_pool_capacity) return 1;
+
+    int capacity = cfg->id_pool_capacity > 0 ? cfg->id_pool_capacity : 64;
+    while (capacity < size) {
+        capacity *= 2;
+    }
+
+    /* Copied rather than realloc'ed: the IDs are rebased from the old pool. */
+    char* pool = malloc(capacity);
+    if (pool == NULL) {
+        fprintf(stderr, "Memory allocation failed for %d bytes of process IDs\n", size);
+        return 0;
+    }
+    if (cfg->id_pool) {
+        memcpy(pool, cfg->id_pool, cfg->id_pool_size);
+        rebase_ids(cfg->processes, cfg->capacity, cfg->id_pool, pool);
+        free(cfg->id_pool);
+    }
+
+    cfg->id_pool = pool;
+    cfg->id_pool_capacity = capacity;
+    return 1;
+}
+
+int config_set_id(Config* cfg, int index, const char* id) {
+    PROCESS* p = &cfg->processes[index];
+    int size = (int)strlen(id) + 1;
+
+    /* The last ID of the pool is rewritten in place, as the I/O operations are. */
+    int start = cfg->id_pool_size;
+    if (p->ID && p->ID + strlen(p->ID) + 1 == cfg->id_pool + cfg->id_pool_size) {
+        start = (int)(p->ID - cfg->id_pool);
+    }
+    if (!id_pool_reserve(cfg, start + size)) return 0;
+
+    memcpy(cfg->id_pool + start, id, size);
+    p->ID = cfg->id_pool + start;
+    cfg->id_pool_size = start + size;
+    return 1;
+}
+
+static int io_pool_reserve(Config* cfg, int count) {
+    if (count <= cfg->io_pool_capacity) return 1;
+
+    int capacity = cfg->io_pool_capacity > 0 ? cfg->io_pool_capacity : 16;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+
+    IO_OPERATION* pool = realloc(cfg->io_pool, capacity * sizeof(IO_OPERATION));
+    if (pool == NULL) {
+        fprintf(stderr, "Memory allocation failed for %d I/O operations\n", count);
+        return 0;
+    }
+
+    cfg->io_pool = pool;
+    cfg->io_pool_capacity = capacity;
+    return 1;
+}
+
+int config_set_io_count(Config* cfg, int index, int count) {
+    PROCESS* p = &cfg->processes[index];
+    if (count < 0) count = 0;
+
+    int at_end = p->io_start + p->io_count == cfg->io_pool_count;
+
+    if (count <= p->io_count) {
+        if (at_end) cfg->io_pool_count = p->io_start + count;
+        p->io_count = count;
+        return 1;
+    }
+
+    int start = at_end ? p->io_start : cfg->io_pool_count;
+    if (!io_pool_reserve(cfg, start + count)) return 0;
+
+    if (!at_end && p->io_count > 0) {
+        memcpy(&cfg->io_pool[start], &cfg->io_pool[p->io_start], p->io_count * sizeof(IO_OPERATION));
+    }
+    memset(&cfg->io_pool[start + p->io_count], 0, (count - p->io_count) * sizeof(IO_OPERATION));
+
+    p->io_start = start;
+    p->io_count = count;
+    cfg->io_pool_count = start + count;
+    return 1;
+}
+
+IO_OPERATION* process_io(Config* cfg, const PROCESS* p) {
+    return cfg->io_pool + p->io_start;
+}
+
+static int arrives_before(const PROCESS* processes, int a, int b) {
+    if (processes[a].arrival_time != processes[b].arrival_time) {
+        return processes[a].arrival_time < processes[b].arrival_time;
+    }
+    return a < b;
+}
+
+static void arrival_sift_down(const PROCESS* processes, int* order, int index, int count) {
+    int id = order[index];
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= count) break;
+        if (child + 1 < count && arrives_before(processes, order[child], order[child + 1])) {
+            child++;
+        }
+        if (!arrives_before(processes, id, order[child])) break;
+        order[index] = order[child];
+        index = child;
+    }
+    order[index] = id;
+}
+
+/* Heap sort of the process indices by (arrival_time, index). */
+void config_sort_arrivals(Config* cfg) {
+    int* order = cfg->arrival_order;
+    int count = cfg->process_count;
+
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        arrival_sift_down(cfg->processes, order, i, count);
+    }
+    for (int end = count - 1; end > 0; end--) {
+        int last = order[end];
+        order[end] = order[0];
+        order[0] = last;
+        arrival_sift_down(cfg->processes, order, 0, end);
+    }
+}
+
+void config_release(Config* cfg) {
+    if (!cfg) return;
+    free(cfg->processes);
+    free(cfg->io_pool);
+    free(cfg->id_pool);
+    cfg->processes = NULL;
+    cfg->pcbs = NULL;
+    cfg->arrival_order = NULL;
+    cfg->process_count = 0;
+    cfg->capacity = 0;
+    cfg->io_pool = NULL;
+    cfg->io_pool_count = 0;
+    cfg->io_pool_capacity = 0;
+    cfg->id_pool = NULL;
+    cfg->id_pool_size = 0;
+    cfg->id_pool_capacity = 0;
+}
+
+/* Deep copy into an empty configuration; the PCBs are left to initialize_PCB. */
+int config_copy(Config* dst, const Config* src) {
+    if (!config_reserve(dst, src->process_count)) return 0;
+    if (!io_pool_reserve(dst, src->io_pool_count)) return 0;
+    if (!id_pool_reserve(dst, src->id_pool_size)) return 0;
+
+    memcpy(dst->processes, src->processes, src->process_count * sizeof(PROCESS));
+    memcpy(dst->arrival_order, src->arrival_order, src->process_count * sizeof(int));
+    if (src->io_pool_count > 0) {
+        memcpy(dst->io_pool, src->io_pool, src->io_pool_count * sizeof(IO_OPERATION));
+    }
+    if (src->id_pool_size > 0) {
+        memcpy(dst->id_pool, src->id_pool, src->id_pool_size);
+    }
+    rebase_ids(dst->processes, src->process_count, src->id_pool, dst->id_pool);
+    dst->process_count = src->process_count;
+    dst->io_pool_count = src->io_pool_count;
+    dst->id_pool_size = src->id_pool_size;
+    memcpy(dst->time_unit, src->time_unit, sizeof(dst->time_unit));
+    return 1;
+}
+
+static int has_config_suffix(const char* name) {
+    static const char* suffixes[] = { ".txt", ".conf", ".cfg" };
+    size_t len = strlen(name);
+    for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); i++) {
+        size_t n = strlen(suffixes[i]);
+        if (len > n && strcmp(name + len - n, suffixes[i]) == 0) return 1;
+    }
+    return 0;
+}
+
+static int compare_names(const void* a, const void* b) {
+    return strcmp(a, b);
+}
+
+int config_list_files(const char* dir, char (*names)[CONFIG_NAME_LEN], int max) {
+    DIR* d = opendir(dir);
+    if (!d) return 0;
+
+    int count = 0;
+    struct dirent* entry;
+    while ((entry = readdir(d)) != NULL && count < max) {
+        if (!has_config_suffix(entry->d_name)) continue;
+        strncpy(names[count], entry->d_name, CONFIG_NAME_LEN - 1);
+        names[count][CONFIG_NAME_LEN - 1] = '\0';
+        count++;
+    }
+    closedir(d);
+
+    qsort(names, count, CONFIG_NAME_LEN, compare_names);
+    return count;
+}
+
+int load_config(char* path , Config* cfg) {
+    FILE* file;
+    if ((file = fopen(path, "r")) == NULL) {
+        perror("fopen()");
+        return 0;
+    } 
+    
+    
+    char line[256];
+    int process = -1;
+    int p_io=-1;
+    int io_declared = 0;
+
+    cfg->process_count = 0;
+    cfg->io_pool_count = 0;
+    cfg->id_pool_size = 0;
+    cfg->time_unit[0] = '\0';
+    if (cfg->processes) {
+        memset(cfg->processes, 0, cfg->capacity * sizeof(PROCESS));
+    }
+
+    while(fgets(line, sizeof(line), file)) {
+
+        trim(line);
+        if (line[0] == '#' || strlen(line) ==0 ) {
+            continue;
+        } 
+        
+        
+        if (line[0] == '[') {
+            char section[20]; 
+            sscanf(line, "[%[^]]]", section);
+            
+            
+            if (strncmp(section, "process",7)==0 && strchr(section, '_')==NULL){
+                sscanf( section, "process%d", &process);
+                p_io=-1;
+                io_declared = 0;
+                if (process >= 0 && !config_reserve(cfg, process + 1)) {
+                    fclose(file);
+                    return 0;
+                }
+            }
+            
+            else if (strncmp(section, "process_io",10)==0 && strchr(section, '_')!=NULL){
+                sscanf( section, "process%d_io%d", &process, &p_io);
+                p_io++;
+                
+            }
+            continue;
+        }
+
+        char* eq = strchr(line, '=');
+        if (eq != NULL) {
+            *eq = '\0';
+            char* key = line;
+            char* value = eq + 1;
+
+            
+            trim(key);
+            trim(value);
+            
+            if (strcmp(key, "process_count") == 0) {
+                cfg ->process_count = atoi(value);
+                if (cfg->process_count < 0) cfg->process_count = 0;
+                if (!config_reserve(cfg, cfg->process_count)) {
+                    fclose(file);
+                    return 0;
+                }
+                continue;
+            }
+
+            if (strcmp(key, "time_unit") == 0) {
+                strncpy(cfg->time_unit, value, sizeof(cfg->time_unit) - 1);
+                cfg->time_unit[sizeof(cfg->time_unit) - 1] = '\0';
+                continue;
+            }
+
+            if (process < 0) {
+                continue;
+            }
+
+            
+            if(p_io == -1){
+                if (strcmp(key , "ID")==0){
+                    if (!config_set_id(cfg, process, value)) {
+                        fclose(file);
+                        return 0;
+                    }
+                }
+                else if (strcmp(key , "arrival_time")==0){
+                    cfg -> processes[process].arrival_time = atoll(value);
+                }
+                else if (strcmp(key , "execution_time")==0){
+                    cfg -> processes[process].execution_time = atoll(value);
+                }
+                else if (strcmp(key , "priority")==0){
+                    cfg -> processes[process].priority = atoi(value);
+                }
+                else if (strcmp(key , "io_count")==0){
+                    if (!config_set_io_count(cfg, process, atoi(value))) {
+                        fclose(file);
+                        return 0;
+                    }
+                    io_declared = 1;
+                }
+            }
+
+
+            else {
+                /* operations past the declared io_count are never scheduled */
+                if (p_io >= cfg->processes[process].io_count) {
+                    if (io_declared) continue;
+                    if (!config_set_io_count(cfg, process, p_io + 1)) {
+                        fclose(file);
+                        return 0;
+                    }
+                }
+
+                IO_OPERATION* io = &process_io(cfg, &cfg->processes[process])[p_io];
+                if (strcmp(key , "start_time")==0){
+                    io->start_time = atoll(value);
+                }
+                else if (strcmp(key , "duration")==0){
+                    io->duration = atoll(value);
+                }
+            }
+
+        } 
+    }
+    fclose(file);
+
+    for (int i = 0; i < cfg->process_count; i++) {
+        if (!cfg->processes[i].ID && !config_set_id(cfg, i, "")) return 0;
+    }
+    return 1;
+}
+void free_config(Config *cfg)
+{
+    if (!cfg) return;
+    config_release(cfg);
+    free(cfg);
+}
+
+int save_config(char* path, Config* cfg) {
+    if (!path || !cfg) return 0;
+
+    FILE *file = fopen(path, "w");
+    if (!file) return 0;
+
+    fprintf(file, "#config file\n\n");
+    if (cfg->time_unit[0] != '\0') {
+        fprintf(file, "time_unit = %s\n", cfg->time_unit);
+    }
+    fprintf(file, "process_count = %d\n\n", cfg->process_count);
+
+    for (int i = 0; i < cfg->process_count; i++) {
+        PROCESS *p = &cfg->processes[i];
+        fprintf(file, "[process%d]\n", i);
+        fprintf(file, "ID = %s\n", p->ID);
+        fprintf(file, "arrival_time = %lld\n", p->arrival_time);
+        fprintf(file, "execution_time = %lld\n", p->execution_time);
+        fprintf(file, "priority = %d\n", p->priority);
+        fprintf(file, "io_count = %d\n\n", p->io_count);
+
+        IO_OPERATION *io = process_io(cfg, p);
+        for (int j = 0; j < p->io_count; j++) {
+            fprintf(file, "[process%d_io%d]\n", i, j);
+            fprintf(file, "start_time = %lld\n", io[j].start_time);
+            fprintf(file, "duration = %lld\n\n", io[j].duration);
+        }
+    }
+
+    fclose(file);
+    return 1;
 }
\ No newline at end of file
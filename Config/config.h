@@ -1,25 +1,62 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
-#ifndef CONFIG_H
-
-#define CONFIG_H
-
-#include "types.h"
-
-typedef struct 
-{
-    PROCESS processes[20];
-    int process_count;
-} Config;
-
-void trim(char* str);
-
-int load_config( char* filename, Config* cfg); 
-int save_config( char* filename, Config* cfg);
-void free_config(Config *cfg);
-#endif
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef CONFIG_H
+
+#define CONFIG_H
+
+#include "types.h"
+
+#define CONFIG_NAME_LEN 256
+
+/*
+ * Process table: processes, their PCBs and the arrival order share one
+ * allocation of `capacity` slots, grown geometrically by config_reserve.
+ * arrival_order lists the process indices by arrival time (then index);
+ * it is rebuilt by config_sort_arrivals before every run.
+ * The I/O operations of every process are stored back to back in
+ * io_pool; a process references its own with io_start and io_count.
+ * The IDs are strings in id_pool, set with config_set_id; the pointers
+ * follow the pool when it grows.
+ */
+typedef struct 
+{
+    PROCESS* processes;
+    PCB* pcbs;
+    int* arrival_order;
+    int process_count;
+    int capacity;
+
+    IO_OPERATION* io_pool;
+    int io_pool_count;
+    int io_pool_capacity;
+
+    char* id_pool;
+    int id_pool_size;
+    int id_pool_capacity;
+
+    char time_unit[8];      /* e.g. "ns", "us", "ms"; empty for plain ticks */
+} Config;
+
+void trim(char* str);
+
+int config_reserve(Config* cfg, int count);
+PROCESS* config_add_process(Config* cfg);
+int config_set_io_count(Config* cfg, int index, int count);
+int config_set_id(Config* cfg, int index, const char* id);
+IO_OPERATION* process_io(Config* cfg, const PROCESS* p);
+void config_sort_arrivals(Config* cfg);
+void config_release(Config* cfg);
+int config_copy(Config* dst, const Config* src);
+
+/* Configuration files (.txt, .conf, .cfg) of a directory, sorted by name. */
+int config_list_files(const char* dir, char (*names)[CONFIG_NAME_LEN], int max);
+
+int load_config( char* filename, Config* cfg); 
+int save_config( char* filename, Config* cfg);
+void free_config(Config *cfg);
+#endif
@@ -1,54 +1,68 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
-#ifndef TYPES_H
-
-#define TYPES_H
-
-typedef struct 
-{
-    int start_time;
-    int duration;
-} IO_OPERATION;
-
-
-typedef struct 
-{
-    char ID[4];
-    int arrival_time;
-    int execution_time;
-    int priority;
-    IO_OPERATION io_operations[20];
-    int io_count;
-} PROCESS;
-
-
-typedef struct {
-    PROCESS process;
-    int remaining_time;
-    int executed_time;
-    int io_index;
-    int io_remaining;
-    int finished;
-    int in_io;
-    int wait_time;
-} PCB;
-
-typedef struct QueueNode{
-    PROCESS process;
-    struct QueueNode* next;
-} QueueNode;
-
-typedef struct{
-    QueueNode* start;
-    QueueNode* end;
-    int size;
-
-}QUEUE;
-
-
-#endif
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef TYPES_H
+
+#define TYPES_H
+
+/*
+ * Simulated time, counted in the time unit declared by the configuration
+ * file (time_unit). 64 bits so that long traces at ns or us resolution
+ * do not overflow.
+ */
+typedef long long sim_time_t;
+
+typedef struct 
+{
+    sim_time_t start_time;
+    sim_time_t duration;
+} IO_OPERATION;
+
+
+typedef struct 
+{
+    const char* ID;     /* in the configuration ID pool */
+    sim_time_t arrival_time;
+    sim_time_t execution_time;
+    int priority;
+    int io_start;       /* first operation in the configuration I/O pool */
+    int io_count;
+} PROCESS;
+
+
+typedef struct {
+    PROCESS process;
+    const IO_OPERATION* io_operations;
+    sim_time_t remaining_time;
+    sim_time_t executed_time;
+    int io_index;
+    sim_time_t io_remaining;
+    int finished;
+    int in_io;
+    sim_time_t wait_time;
+} PCB;
+
+/*
+ * Links of every process handle, allocated once per run. The queues
+ * sharing a pool hold each process at most once among them.
+ */
+typedef struct {
+    int* next;
+    int* prev;
+    int capacity;
+} QueuePool;
+
+typedef struct{
+    QueuePool* pool;
+    int start;
+    int end;
+    int size;
+
+}QUEUE;
+
+
+#endif
@@ -1,364 +1,369 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
-#include <gtk/gtk.h>
-#include <string.h>
-#include <stdio.h>
-#include "gantt_chart.h"
-
-
-GanttSlice slices[MAX_SLICES];
-int slice_count = 0;
-
-
-IOSlice io_slices[MAX_SLICES];
-int io_slice_count = 0;
-
-
-static const char* COLOR_PALETTE[] = {
-    "#3498db", "#e74c3c", "#2ecc71", "#f39c12", "#9b59b6",
-    "#1abc9c", "#e67e22", "#34495e", "#16a085", "#c0392b",
-    "#27ae60", "#2980b9", "#8e44ad", "#d35400", "#7f8c8d"
-};
-static const int COLOR_COUNT = 15;
-
-
-static const char* IO_COLOR_PALETTE[] = {
-    "#5dade2", "#ec7063", "#58d68d", "#f8c471", "#af7ac5",
-    "#48c9b0", "#eb984e", "#5d6d7e", "#45b39d", "#cd6155",
-    "#52be80", "#5499c7", "#a569bd", "#dc7633", "#95a5a6"
-};
-
-#define MIN_PIXELS_PER_TIME_UNIT 50
-
-
-void add_gantt_slice(const char* pid, int start, int duration, const char* color) {
-    if (slice_count >= MAX_SLICES) {
-        g_warning("Maximum Gantt slices reached (%d)", MAX_SLICES);
-        return;
-    }
-    
-    
-    if (slice_count > 0 && 
-        strcmp(slices[slice_count-1].pid, pid) == 0 && 
-        (slices[slice_count-1].start + slices[slice_count-1].duration) == start) {
-        slices[slice_count-1].duration += duration;
-    } else {
-        // Add new slice
-        strncpy(slices[slice_count].pid, pid, MAX_PID_LEN - 1);
-        slices[slice_count].pid[MAX_PID_LEN - 1] = '\0';
-        slices[slice_count].start = start;
-        slices[slice_count].duration = duration;
-        slices[slice_count].color = color ? color : get_process_color(pid);
-        slice_count++;
-    }
-}
-
-
-void add_io_slice(const char* pid, int start, int duration, const char* color, const char* io_type) {
-    if (io_slice_count >= MAX_SLICES) {
-        g_warning("Maximum I/O slices reached (%d)", MAX_SLICES);
-        return;
-    }
-    
-
-    strncpy(io_slices[io_slice_count].pid, pid, MAX_PID_LEN - 1);
-    io_slices[io_slice_count].pid[MAX_PID_LEN - 1] = '\0';
-    io_slices[io_slice_count].start = start;
-    io_slices[io_slice_count].duration = duration;
-    io_slices[io_slice_count].color = color ? color : IO_COLOR_PALETTE[io_slice_count % COLOR_COUNT];
-    
-    if (io_type) {
-        strncpy(io_slices[io_slice_count].io_type, io_type, 31);
-        io_slices[io_slice_count].io_type[31] = '\0';
-    } else {
-        strcpy(io_slices[io_slice_count].io_type, "I/O");
-    }
-    
-    io_slice_count++;
-}
-
-
-void clear_gantt_slices(void) {
-    slice_count = 0;
-    memset(slices, 0, sizeof(slices));
-}
-
-
-void clear_io_slices(void) {
-    io_slice_count = 0;
-    memset(io_slices, 0, sizeof(io_slices));
-}
-
-
-const char* get_process_color(const char* pid) {
-    if (!pid) return COLOR_PALETTE[0];
-    
-    
-    unsigned int hash = 0;
-    for (int i = 0; pid[i] != '\0'; i++) {
-        hash = hash * 31 + pid[i];
-    }
-    
-    return COLOR_PALETTE[hash % COLOR_COUNT];
-}
-
-
-static int get_gantt_required_width(void) {
-    int total_time = 0;
-    
-    
-    for (int i = 0; i < slice_count; i++) {
-        int end = slices[i].start + slices[i].duration;
-        if (end > total_time) total_time = end;
-    }
-    
-    
-    for (int i = 0; i < io_slice_count; i++) {
-        int end = io_slices[i].start + io_slices[i].duration;
-        if (end > total_time) total_time = end;
-    }
-    
-    if (total_time == 0) return 400;
-    
-    const int MARGIN = 40;
-    int min_chart_width = total_time * MIN_PIXELS_PER_TIME_UNIT;
-    
-    return min_chart_width + 2 * MARGIN;
-}
-
-
-static void gantt_draw_function(GtkDrawingArea *area, cairo_t *cr, int width, int height, void *user_data) {
-    int required_width = get_gantt_required_width();
-    (void)user_data;
-    
-    int required_height = (io_slice_count > 0) ? 280 : 150;
-    gtk_widget_set_size_request(GTK_WIDGET(area), required_width, required_height);
-    
-    if (slice_count == 0 && io_slice_count == 0) {
-        
-        cairo_set_source_rgb(cr, 0.7, 0.7, 0.7);
-        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
-        cairo_set_font_size(cr, 14);
-        cairo_move_to(cr, width/2 - 100, height/2);
-        cairo_show_text(cr, "No scheduling data available");
-        return;
-    }
-    
-    
-    int total_time = 0;
-    for (int i = 0; i < slice_count; i++) {
-        int end = slices[i].start + slices[i].duration;
-        if (end > total_time) total_time = end;
-    }
-    for (int i = 0; i < io_slice_count; i++) {
-        int end = io_slices[i].start + io_slices[i].duration;
-        if (end > total_time) total_time = end;
-    }
-    
-    if (total_time == 0) return;
-    
-    
-    const int MARGIN = 40;
-    const int BAR_HEIGHT = 50;
-    const int LABEL_HEIGHT = 30;
-    const int TIME_MARKER_HEIGHT = 25;
-    const int CHART_SPACING = 20; 
-
-    
-    int min_chart_width = total_time * MIN_PIXELS_PER_TIME_UNIT;
-    int available_width = width - 2 * MARGIN;
-    int chart_width = (min_chart_width > available_width) ? min_chart_width : available_width;
-
-    int cpu_chart_top = MARGIN + LABEL_HEIGHT;
-    
-
-    cairo_set_source_rgb(cr, 0, 0, 0);
-    cairo_set_font_size(cr, 12);
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_move_to(cr, MARGIN, cpu_chart_top - 10);
-    cairo_show_text(cr, "CPU Timeline");
-    
-
-    cairo_set_source_rgb(cr, 1, 1, 1);
-    cairo_rectangle(cr, MARGIN, cpu_chart_top, chart_width, BAR_HEIGHT);
-    cairo_fill(cr);
-    
-
-    cairo_set_source_rgb(cr, 0.5, 0.5, 0.5);
-    cairo_set_line_width(cr, 1);
-    cairo_rectangle(cr, MARGIN, cpu_chart_top, chart_width, BAR_HEIGHT);
-    cairo_stroke(cr);
-    
-
-    for (int i = 0; i < slice_count; i++) {
-        GanttSlice *slice = &slices[i];
-        
-        double x = MARGIN + (double)slice->start / total_time * chart_width;
-        double w = (double)slice->duration / total_time * chart_width;
-        
-
-        int r, g, b;
-        if (sscanf(slice->color, "#%02x%02x%02x", &r, &g, &b) == 3) {
-            cairo_set_source_rgb(cr, r/255.0, g/255.0, b/255.0);
-        } else {
-            cairo_set_source_rgb(cr, 0.2, 0.6, 1.0);
-        }
-        
-
-        cairo_rectangle(cr, x, cpu_chart_top, w, BAR_HEIGHT);
-        cairo_fill_preserve(cr);
-        
-
-        cairo_set_source_rgb(cr, 0, 0, 0);
-        cairo_set_line_width(cr, 1);
-        cairo_stroke(cr);
-        
-
-        if (w > 30) {
-            cairo_set_source_rgb(cr, 1, 1, 1);
-            cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-            cairo_set_font_size(cr, 12);
-            
-            cairo_text_extents_t extents;
-            cairo_text_extents(cr, slice->pid, &extents);
-            
-            cairo_move_to(cr, x + w/2 - extents.width/2, 
-                         cpu_chart_top + BAR_HEIGHT/2 + extents.height/2);
-            cairo_show_text(cr, slice->pid);
-        }
-    }
-    
-
-    cairo_set_source_rgb(cr, 0, 0, 0);
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
-    cairo_set_font_size(cr, 9);
-    
-    for (int t = 0; t <= total_time; t++) {
-        double x = MARGIN + (double)t / total_time * chart_width;
-        
-
-        cairo_set_line_width(cr, 1);
-        cairo_move_to(cr, x, cpu_chart_top + BAR_HEIGHT);
-        cairo_line_to(cr, x, cpu_chart_top + BAR_HEIGHT + 5);
-        cairo_stroke(cr);
-        
-
-        char time_str[16];
-        snprintf(time_str, sizeof(time_str), "%d", t);
-        cairo_text_extents_t extents;
-        cairo_text_extents(cr, time_str, &extents);
-        
-        cairo_move_to(cr, x - extents.width/2, 
-                     cpu_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT);
-        cairo_show_text(cr, time_str);
-    }
-    
-
-    if (io_slice_count > 0) {
-        int io_chart_top = cpu_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT + CHART_SPACING;
-        
-
-        cairo_set_source_rgb(cr, 0, 0, 0);
-        cairo_set_font_size(cr, 12);
-        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-        cairo_move_to(cr, MARGIN, io_chart_top - 5);
-        cairo_show_text(cr, "I/O Timeline");
-        
-
-        cairo_set_source_rgb(cr, 0.98, 0.98, 0.98);
-        cairo_rectangle(cr, MARGIN, io_chart_top, chart_width, BAR_HEIGHT);
-        cairo_fill(cr);
-        
-
-        cairo_set_source_rgb(cr, 0.5, 0.5, 0.5);
-        cairo_set_line_width(cr, 1);
-        cairo_rectangle(cr, MARGIN, io_chart_top, chart_width, BAR_HEIGHT);
-        cairo_stroke(cr);
-        
-
-        for (int i = 0; i < io_slice_count; i++) {
-            IOSlice *slice = &io_slices[i];
-            
-            double x = MARGIN + (double)slice->start / total_time * chart_width;
-            double w = (double)slice->duration / total_time * chart_width;
-            
-
-            int r, g, b;
-            if (sscanf(slice->color, "#%02x%02x%02x", &r, &g, &b) == 3) {
-                cairo_set_source_rgb(cr, r/255.0, g/255.0, b/255.0);
-            } else {
-                cairo_set_source_rgb(cr, 0.9, 0.6, 0.3);
-            }
-            
-
-            cairo_rectangle(cr, x, io_chart_top, w, BAR_HEIGHT);
-            cairo_fill_preserve(cr);
-            
-
-            cairo_set_source_rgb(cr, 0, 0, 0);
-            cairo_set_line_width(cr, 1);
-            cairo_stroke(cr);
-            
-
-            if (w > 30) {
-                cairo_set_source_rgb(cr, 0.2, 0.2, 0.2);
-                cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-                cairo_set_font_size(cr, 11);
-                
-                char label[64];
-                snprintf(label, sizeof(label), "%s", slice->pid);
-                
-                cairo_text_extents_t extents;
-                cairo_text_extents(cr, label, &extents);
-                
-                cairo_move_to(cr, x + w/2 - extents.width/2, 
-                             io_chart_top + BAR_HEIGHT/2 + extents.height/2);
-                cairo_show_text(cr, label);
-            }
-        }
-        
-        
-        cairo_set_source_rgb(cr, 0, 0, 0);
-        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
-        cairo_set_font_size(cr, 9);
-        
-        for (int t = 0; t <= total_time; t++) {
-            double x = MARGIN + (double)t / total_time * chart_width;
-            
-            
-            cairo_set_line_width(cr, 1);
-            cairo_move_to(cr, x, io_chart_top + BAR_HEIGHT);
-            cairo_line_to(cr, x, io_chart_top + BAR_HEIGHT + 5);
-            cairo_stroke(cr);
-
-            char time_str[16];
-        snprintf(time_str, sizeof(time_str), "%d", t);
-        cairo_text_extents_t extents;
-        cairo_text_extents(cr, time_str, &extents);
-        
-        cairo_move_to(cr, x - extents.width/2, 
-                     io_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT);
-        cairo_show_text(cr, time_str);
-        }
-    }
-    
-
-    cairo_set_source_rgb(cr, 0, 0, 0);
-    cairo_set_font_size(cr, 14);
-    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
-    cairo_move_to(cr, MARGIN, MARGIN - 10);
-    cairo_show_text(cr, "Process Execution & I/O Timeline");
-}
-
-
-GtkWidget* create_gantt_chart_widget(void) {
-    GtkWidget *drawing_area = gtk_drawing_area_new();
-    gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(drawing_area), gantt_draw_function, NULL, NULL);
-    
-    return drawing_area;
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <gtk/gtk.h>
+#include <string.h>
+#include <stdio.h>
+#include "gantt_chart.h"
+#include "../Utils/sim_context.h"
+
+
+static const Config* gantt_config = NULL;
+/* Time marked on the chart by the time scrubber, -1 for none. */
+static sim_time_t gantt_cursor = -1;
+
+
+static const char* COLOR_PALETTE[] = {
+    "#3498db", "#e74c3c", "#2ecc71", "#f39c12", "#9b59b6",
+    "#1abc9c", "#e67e22", "#34495e", "#16a085", "#c0392b",
+    "#27ae60", "#2980b9", "#8e44ad", "#d35400", "#7f8c8d"
+};
+static const int COLOR_COUNT = 15;
+
+
+#define MIN_PIXELS_PER_TIME_UNIT 50
+/* Long timelines are squeezed into a bounded canvas with a bounded number of labels. */
+#define MAX_CHART_WIDTH 20000
+#define MAX_TIME_LABELS 100
+
+
+void gantt_set_config(const Config* config) {
+    gantt_config = config;
+}
+
+
+void gantt_set_cursor(sim_time_t time) {
+    gantt_cursor = time;
+}
+
+
+const char* gantt_process_name(int process) {
+    if (process == GANTT_IDLE) return "IDLE";
+    if (!gantt_config || process < 0 || process >= gantt_config->process_count) return "?";
+    return gantt_config->processes[process].ID;
+}
+
+
+const char* gantt_slice_color(const GanttSlice* slice) {
+    return slice->color ? slice->color : get_process_color(gantt_process_name(slice->process));
+}
+
+
+const char* get_process_color(const char* pid) {
+    if (!pid) return COLOR_PALETTE[0];
+    
+    
+    unsigned int hash = 0;
+    for (int i = 0; pid[i] != '\0'; i++) {
+        hash = hash * 31 + pid[i];
+    }
+    
+    return COLOR_PALETTE[hash % COLOR_COUNT];
+}
+
+
+static sim_time_t get_gantt_total_time(const Timeline *timeline) {
+    sim_time_t total_time = 0;
+    
+    
+    for (int i = 0; i < timeline->slice_count; i++) {
+        sim_time_t end = timeline->slices[i].start + timeline->slices[i].duration;
+        if (end > total_time) total_time = end;
+    }
+    
+    
+    for (int i = 0; i < timeline->io_slice_count; i++) {
+        sim_time_t end = timeline->io_slices[i].start + timeline->io_slices[i].duration;
+        if (end > total_time) total_time = end;
+    }
+    
+    return total_time;
+}
+
+
+static int get_gantt_min_chart_width(sim_time_t total_time) {
+    if (total_time > MAX_CHART_WIDTH / MIN_PIXELS_PER_TIME_UNIT) return MAX_CHART_WIDTH;
+    return (int)total_time * MIN_PIXELS_PER_TIME_UNIT;
+}
+
+
+/* Distance between two time labels, a 1-2-5 multiple of the unit. */
+static sim_time_t get_gantt_label_step(sim_time_t total_time) {
+    sim_time_t step = 1;
+    while (total_time / step > MAX_TIME_LABELS) {
+        if (total_time / (step * 2) <= MAX_TIME_LABELS) return step * 2;
+        if (total_time / (step * 5) <= MAX_TIME_LABELS) return step * 5;
+        step *= 10;
+    }
+    return step;
+}
+
+
+sim_time_t gantt_total_time(void) {
+    return get_gantt_total_time(&sim_current()->timeline);
+}
+
+
+static int get_gantt_required_width(const Timeline *timeline) {
+    sim_time_t total_time = get_gantt_total_time(timeline);
+    
+    if (total_time == 0) return 400;
+    
+    const int MARGIN = 40;
+    int min_chart_width = get_gantt_min_chart_width(total_time);
+    
+    return min_chart_width + 2 * MARGIN;
+}
+
+
+static void gantt_draw_function(GtkDrawingArea *area, cairo_t *cr, int width, int height, void *user_data) {
+    const Timeline *timeline = &sim_current()->timeline;
+    int required_width = get_gantt_required_width(timeline);
+    (void)user_data;
+    
+    int required_height = (timeline->io_slice_count > 0) ? 280 : 150;
+    gtk_widget_set_size_request(GTK_WIDGET(area), required_width, required_height);
+    
+    if (timeline->slice_count == 0 && timeline->io_slice_count == 0) {
+        
+        cairo_set_source_rgb(cr, 0.7, 0.7, 0.7);
+        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+        cairo_set_font_size(cr, 14);
+        cairo_move_to(cr, width/2 - 100, height/2);
+        cairo_show_text(cr, "No scheduling data available");
+        return;
+    }
+    
+    
+    sim_time_t total_time = get_gantt_total_time(timeline);
+    
+    if (total_time == 0) return;
+    
+    sim_time_t label_step = get_gantt_label_step(total_time);
+    
+    
+    const int MARGIN = 40;
+    const int BAR_HEIGHT = 50;
+    const int LABEL_HEIGHT = 30;
+    const int TIME_MARKER_HEIGHT = 25;
+    const int CHART_SPACING = 20; 
+
+    
+    int min_chart_width = get_gantt_min_chart_width(total_time);
+    int available_width = width - 2 * MARGIN;
+    int chart_width = (min_chart_width > available_width) ? min_chart_width : available_width;
+
+    int cpu_chart_top = MARGIN + LABEL_HEIGHT;
+    
+
+    cairo_set_source_rgb(cr, 0, 0, 0);
+    cairo_set_font_size(cr, 12);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    cairo_move_to(cr, MARGIN, cpu_chart_top - 10);
+    if (gantt_config && gantt_config->time_unit[0] != '\0') {
+        char title[32];
+        snprintf(title, sizeof(title), "CPU Timeline (%s)", gantt_config->time_unit);
+        cairo_show_text(cr, title);
+    } else {
+        cairo_show_text(cr, "CPU Timeline");
+    }
+    
+
+    cairo_set_source_rgb(cr, 1, 1, 1);
+    cairo_rectangle(cr, MARGIN, cpu_chart_top, chart_width, BAR_HEIGHT);
+    cairo_fill(cr);
+    
+
+    cairo_set_source_rgb(cr, 0.5, 0.5, 0.5);
+    cairo_set_line_width(cr, 1);
+    cairo_rectangle(cr, MARGIN, cpu_chart_top, chart_width, BAR_HEIGHT);
+    cairo_stroke(cr);
+    
+
+    for (int i = 0; i < timeline->slice_count; i++) {
+        const GanttSlice *slice = &timeline->slices[i];
+        
+        double x = MARGIN + (double)slice->start / total_time * chart_width;
+        double w = (double)slice->duration / total_time * chart_width;
+        
+
+        int r, g, b;
+        if (sscanf(gantt_slice_color(slice), "#%02x%02x%02x", &r, &g, &b) == 3) {
+            cairo_set_source_rgb(cr, r/255.0, g/255.0, b/255.0);
+        } else {
+            cairo_set_source_rgb(cr, 0.2, 0.6, 1.0);
+        }
+        
+
+        cairo_rectangle(cr, x, cpu_chart_top, w, BAR_HEIGHT);
+        cairo_fill_preserve(cr);
+        
+
+        cairo_set_source_rgb(cr, 0, 0, 0);
+        cairo_set_line_width(cr, 1);
+        cairo_stroke(cr);
+        
+
+        if (w > 30) {
+            cairo_set_source_rgb(cr, 1, 1, 1);
+            cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+            cairo_set_font_size(cr, 12);
+            
+            const char *pid = gantt_process_name(slice->process);
+            cairo_text_extents_t extents;
+            cairo_text_extents(cr, pid, &extents);
+            
+            cairo_move_to(cr, x + w/2 - extents.width/2, 
+                         cpu_chart_top + BAR_HEIGHT/2 + extents.height/2);
+            cairo_show_text(cr, pid);
+        }
+    }
+    
+
+    cairo_set_source_rgb(cr, 0, 0, 0);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+    cairo_set_font_size(cr, 9);
+    
+    for (sim_time_t t = 0; t <= total_time; t += label_step) {
+        double x = MARGIN + (double)t / total_time * chart_width;
+        
+
+        cairo_set_line_width(cr, 1);
+        cairo_move_to(cr, x, cpu_chart_top + BAR_HEIGHT);
+        cairo_line_to(cr, x, cpu_chart_top + BAR_HEIGHT + 5);
+        cairo_stroke(cr);
+        
+
+        char time_str[24];
+        snprintf(time_str, sizeof(time_str), "%lld", t);
+        cairo_text_extents_t extents;
+        cairo_text_extents(cr, time_str, &extents);
+        
+        cairo_move_to(cr, x - extents.width/2, 
+                     cpu_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT);
+        cairo_show_text(cr, time_str);
+    }
+    
+
+    if (timeline->io_slice_count > 0) {
+        int io_chart_top = cpu_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT + CHART_SPACING;
+        
+
+        cairo_set_source_rgb(cr, 0, 0, 0);
+        cairo_set_font_size(cr, 12);
+        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+        cairo_move_to(cr, MARGIN, io_chart_top - 5);
+        cairo_show_text(cr, "I/O Timeline");
+        
+
+        cairo_set_source_rgb(cr, 0.98, 0.98, 0.98);
+        cairo_rectangle(cr, MARGIN, io_chart_top, chart_width, BAR_HEIGHT);
+        cairo_fill(cr);
+        
+
+        cairo_set_source_rgb(cr, 0.5, 0.5, 0.5);
+        cairo_set_line_width(cr, 1);
+        cairo_rectangle(cr, MARGIN, io_chart_top, chart_width, BAR_HEIGHT);
+        cairo_stroke(cr);
+        
+
+        for (int i = 0; i < timeline->io_slice_count; i++) {
+            const IOSlice *slice = &timeline->io_slices[i];
+            
+            double x = MARGIN + (double)slice->start / total_time * chart_width;
+            double w = (double)slice->duration / total_time * chart_width;
+            
+
+            int r, g, b;
+            if (sscanf(slice->color, "#%02x%02x%02x", &r, &g, &b) == 3) {
+                cairo_set_source_rgb(cr, r/255.0, g/255.0, b/255.0);
+            } else {
+                cairo_set_source_rgb(cr, 0.9, 0.6, 0.3);
+            }
+            
+
+            cairo_rectangle(cr, x, io_chart_top, w, BAR_HEIGHT);
+            cairo_fill_preserve(cr);
+            
+
+            cairo_set_source_rgb(cr, 0, 0, 0);
+            cairo_set_line_width(cr, 1);
+            cairo_stroke(cr);
+            
+
+            if (w > 30) {
+                cairo_set_source_rgb(cr, 0.2, 0.2, 0.2);
+                cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+                cairo_set_font_size(cr, 11);
+                
+                char label[64];
+                snprintf(label, sizeof(label), "%s", gantt_process_name(slice->process));
+                
+                cairo_text_extents_t extents;
+                cairo_text_extents(cr, label, &extents);
+                
+                cairo_move_to(cr, x + w/2 - extents.width/2, 
+                             io_chart_top + BAR_HEIGHT/2 + extents.height/2);
+                cairo_show_text(cr, label);
+            }
+        }
+        
+        
+        cairo_set_source_rgb(cr, 0, 0, 0);
+        cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_NORMAL);
+        cairo_set_font_size(cr, 9);
+        
+        for (sim_time_t t = 0; t <= total_time; t += label_step) {
+            double x = MARGIN + (double)t / total_time * chart_width;
+            
+            
+            cairo_set_line_width(cr, 1);
+            cairo_move_to(cr, x, io_chart_top + BAR_HEIGHT);
+            cairo_line_to(cr, x, io_chart_top + BAR_HEIGHT + 5);
+            cairo_stroke(cr);
+
+            char time_str[24];
+        snprintf(time_str, sizeof(time_str), "%lld", t);
+        cairo_text_extents_t extents;
+        cairo_text_extents(cr, time_str, &extents);
+        
+        cairo_move_to(cr, x - extents.width/2, 
+                     io_chart_top + BAR_HEIGHT + TIME_MARKER_HEIGHT);
+        cairo_show_text(cr, time_str);
+        }
+    }
+    
+
+    if (gantt_cursor >= 0 && gantt_cursor <= total_time) {
+        double x = MARGIN + (double)gantt_cursor / total_time * chart_width;
+        int bottom = cpu_chart_top + BAR_HEIGHT;
+        if (timeline->io_slice_count > 0) {
+            bottom += TIME_MARKER_HEIGHT + CHART_SPACING + BAR_HEIGHT;
+        }
+
+        cairo_set_source_rgb(cr, 0.85, 0.1, 0.1);
+        cairo_set_line_width(cr, 2);
+        cairo_move_to(cr, x, cpu_chart_top - 5);
+        cairo_line_to(cr, x, bottom + 5);
+        cairo_stroke(cr);
+    }
+
+
+    cairo_set_source_rgb(cr, 0, 0, 0);
+    cairo_set_font_size(cr, 14);
+    cairo_select_font_face(cr, "Sans", CAIRO_FONT_SLANT_NORMAL, CAIRO_FONT_WEIGHT_BOLD);
+    cairo_move_to(cr, MARGIN, MARGIN - 10);
+    cairo_show_text(cr, "Process Execution & I/O Timeline");
+}
+
+
+GtkWidget* create_gantt_chart_widget(void) {
+    GtkWidget *drawing_area = gtk_drawing_area_new();
+    gtk_drawing_area_set_draw_func(GTK_DRAWING_AREA(drawing_area), gantt_draw_function, NULL, NULL);
+    
+    return drawing_area;
 }
\ No newline at end of file
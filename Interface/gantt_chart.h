@@ -9,41 +9,15 @@
 #define GANTT_CHART_H
 
 #include <gtk/gtk.h>
-
-#define MAX_SLICES 1000
-#define MAX_PID_LEN 32
-
-
-typedef struct {
-    char pid[MAX_PID_LEN];
-    int start;
-    int duration;
-    const char* color;
-} GanttSlice;
-
-
-typedef struct {
-    char pid[MAX_PID_LEN];
-    int start;
-    int duration;
-    const char* color;
-    char io_type[32]; 
-} IOSlice;
-
-
-extern GanttSlice slices[MAX_SLICES];
-extern int slice_count;
-
-extern IOSlice io_slices[MAX_SLICES];
-extern int io_slice_count;
-
-void add_gantt_slice(const char* pid, int start, int duration, const char* color);
-void clear_gantt_slices(void);
-
-
-void add_io_slice(const char* pid, int start, int duration, const char* color, const char* io_type);
-void clear_io_slices(void);
-
+#include "../Config/config.h"
+#include "../Utils/timeline.h"
+
+void gantt_set_config(const Config* config);
+/* Marks a time on the chart; a negative time removes the mark. */
+void gantt_set_cursor(sim_time_t time);
+sim_time_t gantt_total_time(void);
+const char* gantt_process_name(int process);
+const char* gantt_slice_color(const GanttSlice* slice);
 
 const char* get_process_color(const char* pid);
 
@@ -1,108 +1,193 @@
-
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
- 
-#include "../Config/types.h"
-#include "../Config/config.h"
-#include "./Algorithms.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-
-
-PCB* initialize_PCB(Config* config) {
-    static PCB pcb[50];
-    for (int i = 0; i < config->process_count; i++)
-    {
-        pcb[i].process = config->processes[i];
-        pcb[i].remaining_time =config->processes[i].execution_time;
-        pcb[i].executed_time=0;
-        pcb[i].io_index=0;
-        pcb[i].in_io=0;
-        pcb[i].io_remaining=0;
-        pcb[i].finished=0;
-    }
-    return pcb;
-}
-
-QUEUE add_process_to_queue(QUEUE ready_queue, PROCESS p){
-
-    QueueNode* new_node = malloc(sizeof(QueueNode));
-    if (new_node == NULL) {
-        return ready_queue;
-    }
-    new_node->process = p;
-    new_node->next = NULL;
-
-    if (ready_queue.size == 0){
-        ready_queue.start = new_node;
-        ready_queue.end = new_node;
-    } else {
-        ready_queue.end->next = new_node;
-        ready_queue.end = new_node;
-    }
-
-    ready_queue.size +=1;
-    return ready_queue;
-}
-
-QUEUE remove_process_from_queue(QUEUE ready_queue){
-    if (ready_queue.size == 0) {
-        return ready_queue;
-    }
-
-    QueueNode* temp = ready_queue.start;
-    ready_queue.start = ready_queue.start->next;
-    free(temp);
-    ready_queue.size--;
-
-
-    if (ready_queue.size == 0) {
-        ready_queue.end = NULL;
-    }
-
-    return ready_queue;
-}
-
-PCB* find_pcb_by_id(PCB* pcb, int count, const char* id) {
-    for (int i = 0; i < count; i++) {
-        if (strcmp(pcb[i].process.ID, id) == 0) {
-            return &pcb[i];
-        }
-    }
-    return NULL;
-}
-
-QUEUE remove_specific_process(QUEUE q, const char *ID) {
-    QueueNode *node = q.start;
-    QueueNode *prev = NULL;
-
-    while (node != NULL) {
-        if (strcmp(node->process.ID, ID) == 0) {
-            if (prev == NULL) {
-                q.start = node->next;
-            } else {
-                prev->next = node->next;
-            }
-            if (node == q.end) {
-                q.end = prev;
-            }
-            free(node);
-            q.size--;
-            return q;
-        }
-        prev = node;
-        node = node->next;
-    }
-    return q;
-}
-
-int is_queue_empty(QUEUE q) {
-    return q.size == 0;
-}
-
+
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+ 
+#include "../Config/types.h"
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+PCB* initialize_PCB(Config* config) {
+    if (!config_reserve(config, config->process_count)) {
+        return NULL;
+    }
+
+    PCB* pcb = config->pcbs;
+    for (int i = 0; i < config->process_count; i++)
+    {
+        pcb[i].process = config->processes[i];
+        pcb[i].io_operations = process_io(config, &config->processes[i]);
+        pcb[i].remaining_time =config->processes[i].execution_time;
+        pcb[i].executed_time=0;
+        pcb[i].io_index=0;
+        pcb[i].in_io=0;
+        pcb[i].io_remaining=0;
+        pcb[i].finished=0;
+        pcb[i].wait_time=0;
+    }
+    return pcb;
+}
+
+QueuePool* queue_pool_create(int capacity) {
+    QueuePool* pool = malloc(sizeof(QueuePool));
+    int* links = malloc(2 * (capacity > 0 ? capacity : 1) * sizeof(int));
+    if (pool == NULL || links == NULL) {
+        free(pool);
+        free(links);
+        return NULL;
+    }
+
+    pool->next = links;
+    pool->prev = links + (capacity > 0 ? capacity : 1);
+    pool->capacity = capacity;
+    return pool;
+}
+
+void queue_pool_destroy(QueuePool* pool) {
+    if (!pool) return;
+    free(pool->next);
+    free(pool);
+}
+
+void queue_init(QUEUE* q, QueuePool* pool) {
+    q->pool = pool;
+    q->start = -1;
+    q->end = -1;
+    q->size = 0;
+}
+
+void add_process_to_queue(QUEUE* q, int p){
+    int* next = q->pool->next;
+    int* prev = q->pool->prev;
+
+    next[p] = -1;
+    prev[p] = q->end;
+
+    if (q->size == 0){
+        q->start = p;
+    } else {
+        next[q->end] = p;
+    }
+    q->end = p;
+
+    q->size +=1;
+}
+
+int remove_process_from_queue(QUEUE* q){
+    if (q->size == 0) {
+        return -1;
+    }
+
+    int p = q->start;
+    remove_specific_process(q, p);
+    return p;
+}
+
+int queue_next(const QUEUE* q, int p) {
+    return q->pool->next[p];
+}
+
+void chart_append(char* line, size_t size, const char* text) {
+    size_t used = strlen(line);
+    if (used + 1 >= size) return;
+    strncat(line, text, size - used - 1);
+}
+
+/* chart_append of text `times` times, at the cost of a single call once the line is full. */
+void chart_repeat(char* line, size_t size, const char* text, sim_time_t times) {
+    size_t used = strlen(line);
+    size_t len = strlen(text);
+    if (len == 0) return;
+
+    for (; times > 0 && used + 1 < size; times--) {
+        size_t n = len < size - used - 1 ? len : size - used - 1;
+        memcpy(line + used, text, n);
+        used += n;
+    }
+    line[used] = '\0';
+}
+
+void remove_specific_process(QUEUE* q, int process) {
+    int* next = q->pool->next;
+    int* prev = q->pool->prev;
+
+    if (prev[process] == -1) {
+        q->start = next[process];
+    } else {
+        next[prev[process]] = next[process];
+    }
+    if (next[process] == -1) {
+        q->end = prev[process];
+    } else {
+        prev[next[process]] = prev[process];
+    }
+    q->size--;
+}
+
+int is_queue_empty(const QUEUE* q) {
+    return q->size == 0;
+}
+
+
+static void run_fcfs(Config *config, const SchedulerParams *params) {
+    (void)params;
+    FCFS_Algo(config);
+}
+
+static void run_round_robin(Config *config, const SchedulerParams *params) {
+    RoundRobin_Algo(config, params->quantum);
+}
+
+static void run_multilevel_aging(Config *config, const SchedulerParams *params) {
+    MultilevelAgingScheduler(config, params->quantum, params->aging_interval, params->max_priority);
+}
+
+static void run_preemptive_priority(Config *config, const SchedulerParams *params) {
+    (void)params;
+    run_priority_preemptive(config);
+}
+
+static void run_sjf(Config *config, const SchedulerParams *params) {
+    (void)params;
+    SJF_Algo(config);
+}
+
+static void run_multilevel_static(Config *config, const SchedulerParams *params) {
+    MultilevelStaticScheduler(config, params->quantum);
+}
+
+static void run_srt(Config *config, const SchedulerParams *params) {
+    (void)params;
+    SRT_Algo(config);
+}
+
+const Scheduler schedulers[] = {
+    { "First_In_First_Out",      NULL,               0, 0, run_fcfs },
+    { "Round_Robin",             NULL,               1, 0, run_round_robin },
+    { "Multilevel_Aging",        "MultilevelAging",  1, 1, run_multilevel_aging },
+    { "Preemptive_Priority",     NULL,               0, 0, run_preemptive_priority },
+    { "Shortest_Job_First",      NULL,               0, 0, run_sjf },
+    { "Multilevel_Static",       NULL,               1, 0, run_multilevel_static },
+    { "Shortest_Remaining_Time", NULL,               0, 0, run_srt },
+};
+
+const int scheduler_count = sizeof(schedulers) / sizeof(schedulers[0]);
+
+const Scheduler* find_scheduler(const char *name) {
+    if (!name) return NULL;
+    for (int i = 0; i < scheduler_count; i++) {
+        if (strcmp(schedulers[i].name, name) == 0 ||
+            (schedulers[i].alias && strcmp(schedulers[i].alias, name) == 0)) {
+            return &schedulers[i];
+        }
+    }
+    return NULL;
+}
@@ -9,6 +9,7 @@
 
 #define ALGORITHMS_H
 
+#include <stddef.h>
 #include "../Config/config.h"
 #include "../Config/types.h"
 
@@ -20,7 +21,8 @@ SRT_Scheduler* SRT_create();
 void SRT_add_process(SRT_Scheduler *s, PROCESS *p);
 
 PROCESS* SRT_next(SRT_Scheduler *s);
-PCB* find_pcb_by_id(PCB* pcb, int count, const char* id);
+void chart_append(char* line, size_t size, const char* text);
+void chart_repeat(char* line, size_t size, const char* text, sim_time_t times);
 
 void SRT_destroy(SRT_Scheduler *s);
 
@@ -34,17 +36,51 @@ void SJF_Algo(Config* config);
 
 void RoundRobin_Algo(Config* config, int quantum);
 
+/* The PCB array and queue pool of a run; NULL if the memory cannot be allocated. */
 PCB* initialize_PCB(Config* config);
 
-QUEUE add_process_to_queue(QUEUE ready_queue, PROCESS p);
+QueuePool* queue_pool_create(int capacity);
 
-QUEUE remove_process_from_queue(QUEUE ready_queue);
+void queue_pool_destroy(QueuePool* pool);
 
-QUEUE remove_specific_process(QUEUE q, const char *ID) ;
+void queue_init(QUEUE* q, QueuePool* pool);
+
+void add_process_to_queue(QUEUE* q, int p);
+
+int remove_process_from_queue(QUEUE* q);
+
+void remove_specific_process(QUEUE* q, int process) ;
+
+int queue_next(const QUEUE* q, int p);
 
 void FCFS_Algo(Config* config);
 
 void MultilevelStaticScheduler(Config* config, int quantum);
 
-int is_queue_empty(QUEUE q);
+int is_queue_empty(const QUEUE* q);
+
+typedef struct {
+    int quantum;
+    int aging_interval;
+    int max_priority;
+} SchedulerParams;
+
+/*
+ * Entry of the scheduler table: the algorithm is looked up once per run by
+ * name, then its loop runs with direct calls only. The table does not
+ * share a loop between the algorithms: each run function has its own,
+ * and a common loop with per-policy hooks was declined (see the README).
+ */
+typedef struct {
+    const char *name;
+    const char *alias;
+    int needs_quantum;
+    int needs_aging;
+    void (*run)(Config *config, const SchedulerParams *params);
+} Scheduler;
+
+extern const Scheduler schedulers[];
+extern const int scheduler_count;
+
+const Scheduler* find_scheduler(const char *name);
 #endif
@@ -0,0 +1,414 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "checkpoint.h"
+#include "sim_context.h"
+#include "snapshot.h"
+
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+#define CHECKPOINT_MAGIC "SCHDCKP1"
+
+/*
+ * File layout: the header, the CPU then I/O slices of the timeline, the
+ * first_run, completion and executed arrays of the context, then every
+ * region in the order it was registered.
+ */
+typedef struct {
+    char magic[8];
+    unsigned long long key;
+    unsigned long long layout;  /* hash of the kind and size of every region */
+    unsigned long long size;    /* bytes after the header */
+    unsigned long long sum;     /* hash of those bytes */
+    long long log_offset;
+    long long body_start;
+    int slice_count;
+    int io_slice_count;
+    int dropped;
+    int tracked;
+    sim_time_t busy;
+} CheckpointHeader;
+
+
+static unsigned long long hash_bytes(unsigned long long h, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= bytes[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+void checkpoint_begin(Checkpoint *ck) {
+    SimContext *ctx = sim_current();
+    memset(ck, 0, sizeof(Checkpoint));
+    ck->enabled = ctx->checkpoint.path[0] != '\0' || ctx->snapshots || ctx->seek;
+}
+
+
+static void checkpoint_region(Checkpoint *ck, CheckpointRegionKind kind, void *data, size_t size, PCB *base) {
+    if (!ck->enabled) return;
+    if (ck->count == CHECKPOINT_MAX_REGIONS) {
+        sim_fail("Too many checkpoint regions (%d)", CHECKPOINT_MAX_REGIONS);
+        ck->failed = 1;
+        return;
+    }
+    ck->regions[ck->count++] = (CheckpointRegion){ kind, data, size, base };
+}
+
+
+void checkpoint_add(Checkpoint *ck, void *data, size_t size) {
+    checkpoint_region(ck, CHECKPOINT_RAW, data, size, NULL);
+}
+
+
+void checkpoint_add_clock(Checkpoint *ck, sim_time_t *clock) {
+    ck->clock = clock;
+    checkpoint_region(ck, CHECKPOINT_RAW, clock, sizeof(sim_time_t), NULL);
+}
+
+
+void checkpoint_add_arrivals(Checkpoint *ck, ArrivalStream *arrivals) {
+    ck->arrivals = arrivals;
+    checkpoint_region(ck, CHECKPOINT_RAW, &arrivals->next, sizeof(arrivals->next), NULL);
+}
+
+
+void checkpoint_add_pcbs(Checkpoint *ck, PCB *pcbs, int count) {
+    ck->processes.count = count;
+    ck->processes.pcbs = pcbs;
+    checkpoint_region(ck, CHECKPOINT_PCBS, pcbs, count, NULL);
+}
+
+
+void checkpoint_add_pcb_ref(Checkpoint *ck, PCB **ref, PCB *base, int count) {
+    checkpoint_region(ck, CHECKPOINT_PCB_REF, ref, count, base);
+}
+
+
+void checkpoint_add_queue(Checkpoint *ck, const char *name, CheckpointQueueRole role,
+                          ReadyQueue *queue, const sim_time_t *clock) {
+    if (!ck->enabled) return;
+    if (ck->queue_count == CHECKPOINT_MAX_QUEUES) {
+        sim_fail("Too many checkpoint queues (%d)", CHECKPOINT_MAX_QUEUES);
+        ck->failed = 1;
+        return;
+    }
+    ck->queues[ck->queue_count++] = (CheckpointQueue){ name, role, queue, clock };
+}
+
+
+static size_t region_bytes(const CheckpointRegion *r) {
+    switch (r->kind) {
+        case CHECKPOINT_PCBS: return r->size * sizeof(PCB);
+        case CHECKPOINT_PCB_REF: return sizeof(long long);
+        default: return r->size;
+    }
+}
+
+
+size_t checkpoint_state_size(const Checkpoint *ck) {
+    size_t size = 0;
+    for (int i = 0; i < ck->count; i++) size += region_bytes(&ck->regions[i]);
+    return size;
+}
+
+
+void checkpoint_save_state(const Checkpoint *ck, unsigned char *buffer) {
+    unsigned char *p = buffer;
+    for (int i = 0; i < ck->count; i++) {
+        const CheckpointRegion *r = &ck->regions[i];
+        if (r->kind == CHECKPOINT_PCBS) {
+            const PCB *pcbs = r->data;
+            for (size_t j = 0; j < r->size; j++) {
+                PCB pcb = pcbs[j];
+                pcb.io_operations = NULL;
+                pcb.process.ID = NULL;
+                memcpy(p, &pcb, sizeof(PCB));
+                p += sizeof(PCB);
+            }
+        } else if (r->kind == CHECKPOINT_PCB_REF) {
+            PCB *ref = *(PCB **)r->data;
+            long long index = ref ? ref - r->base : -1;
+            memcpy(p, &index, sizeof(index));
+            p += sizeof(index);
+        } else {
+            memcpy(p, r->data, r->size);
+            p += r->size;
+        }
+    }
+}
+
+
+void checkpoint_load_state(Checkpoint *ck, const unsigned char *buffer) {
+    const unsigned char *p = buffer;
+    for (int i = 0; i < ck->count; i++) {
+        const CheckpointRegion *r = &ck->regions[i];
+        if (r->kind == CHECKPOINT_PCBS) {
+            PCB *pcbs = r->data;
+            for (size_t j = 0; j < r->size; j++) {
+                const IO_OPERATION *io_operations = pcbs[j].io_operations;
+                const char *id = pcbs[j].process.ID;
+                memcpy(&pcbs[j], p, sizeof(PCB));
+                pcbs[j].io_operations = io_operations;
+                pcbs[j].process.ID = id;
+                p += sizeof(PCB);
+            }
+        } else if (r->kind == CHECKPOINT_PCB_REF) {
+            long long index;
+            memcpy(&index, p, sizeof(index));
+            *(PCB **)r->data = index >= 0 && (size_t)index < r->size ? r->base + index : NULL;
+            p += sizeof(index);
+        } else {
+            memcpy(r->data, p, r->size);
+            p += r->size;
+        }
+    }
+}
+
+
+unsigned long long checkpoint_layout(const Checkpoint *ck) {
+    unsigned long long h = FNV_OFFSET;
+    for (int i = 0; i < ck->count; i++) {
+        unsigned long long shape[2] = { ck->regions[i].kind, ck->regions[i].size };
+        h = hash_bytes(h, shape, sizeof(shape));
+    }
+    return h;
+}
+
+
+static size_t payload_bytes(const Checkpoint *ck, const CheckpointHeader *header) {
+    return ((size_t)header->slice_count + header->io_slice_count) * sizeof(SliceRecord)
+         + 3 * (size_t)header->tracked * sizeof(sim_time_t) + checkpoint_state_size(ck);
+}
+
+
+/* The header and payload of path if the file is whole and belongs to the run key. */
+static unsigned char* checkpoint_read(const char *path, unsigned long long key, CheckpointHeader *header) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    unsigned char *payload = NULL;
+    if (fread(header, sizeof(CheckpointHeader), 1, file) != 1 ||
+        memcmp(header->magic, CHECKPOINT_MAGIC, sizeof(header->magic)) != 0 || header->key != key ||
+        header->size > ((unsigned long long)1 << 32) ||
+        header->slice_count < 0 || header->io_slice_count < 0 ||
+        header->tracked < 0 || header->log_offset < 0) goto fail;
+
+    payload = malloc(header->size > 0 ? header->size : 1);
+    if (!payload || fread(payload, 1, header->size, file) != header->size ||
+        fgetc(file) != EOF || hash_bytes(FNV_OFFSET, payload, header->size) != header->sum) goto fail;
+    fclose(file);
+    return payload;
+
+fail:
+    fclose(file);
+    free(payload);
+    return NULL;
+}
+
+
+int checkpoint_probe(const char *path, unsigned long long key, long *log_offset) {
+    CheckpointHeader header;
+    unsigned char *payload = checkpoint_read(path, key, &header);
+    if (!payload) return 0;
+    free(payload);
+    *log_offset = (long)header.log_offset;
+    return 1;
+}
+
+
+typedef struct {
+    FILE *file;
+    unsigned long long sum;
+    unsigned long long size;
+    int ok;
+} CheckpointWriter;
+
+
+static void writer_put(CheckpointWriter *w, const void *data, size_t size) {
+    if (size == 0 || !w->ok) return;
+    if (fwrite(data, 1, size, w->file) != size) w->ok = 0;
+    w->sum = hash_bytes(w->sum, data, size);
+    w->size += size;
+}
+
+
+static int checkpoint_write(const Checkpoint *ck, SimContext *ctx) {
+    const char *path = ctx->checkpoint.path;
+    char tmp[600];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *file = fopen(tmp, "wb");
+    if (!file) return -1;
+
+    const Timeline *t = &ctx->timeline;
+    CheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.key = ctx->checkpoint.key;
+    header.layout = checkpoint_layout(ck);
+    header.body_start = ctx->log.body_start;
+    if (ctx->log.file) {
+        fflush(ctx->log.file);
+        header.log_offset = ftell(ctx->log.file);
+    }
+    header.slice_count = t->slice_count;
+    header.io_slice_count = t->io_slice_count;
+    header.dropped = t->dropped;
+    header.tracked = ctx->tracked;
+    header.busy = ctx->busy;
+
+    CheckpointWriter w = { file, FNV_OFFSET, 0, 1 };
+    if (fwrite(&header, sizeof(header), 1, file) != 1) w.ok = 0;
+
+    int slices = t->slice_count + t->io_slice_count;
+    if (slices > 0) {
+        SliceRecord *records = malloc(slices * sizeof(SliceRecord));
+        if (!records) w.ok = 0;
+        else {
+            timeline_export(t, records);
+            writer_put(&w, records, slices * sizeof(SliceRecord));
+            free(records);
+        }
+    }
+    size_t n = ctx->tracked;
+    writer_put(&w, ctx->first_run, n * sizeof(sim_time_t));
+    writer_put(&w, ctx->completion, n * sizeof(sim_time_t));
+    writer_put(&w, ctx->executed, n * sizeof(sim_time_t));
+
+    size_t state_size = checkpoint_state_size(ck);
+    unsigned char *state = malloc(state_size > 0 ? state_size : 1);
+    if (!state) w.ok = 0;
+    else {
+        checkpoint_save_state(ck, state);
+        writer_put(&w, state, state_size);
+        free(state);
+    }
+
+    header.size = w.size;
+    header.sum = w.sum;
+    if (w.ok && (fseek(file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, file) != 1)) w.ok = 0;
+    if (fflush(file) != 0 || fsync(fileno(file)) != 0) w.ok = 0;
+    if (fclose(file) != 0) w.ok = 0;
+
+    /* Renamed once complete, so the previous checkpoint stays until this one is whole. */
+    if (!w.ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        sim_printf("Could not write checkpoint %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+
+static int checkpoint_restore(Checkpoint *ck, SimContext *ctx) {
+    const char *path = ctx->checkpoint.path;
+    CheckpointHeader header;
+    unsigned char *payload = checkpoint_read(path, ctx->checkpoint.key, &header);
+
+    /* The file was checked before the run started, so only another build of the program gets here. */
+    if (!payload || header.layout != checkpoint_layout(ck) || header.tracked != ctx->tracked ||
+        header.size != payload_bytes(ck, &header)) {
+        sim_fail("Checkpoint %s does not match this program; remove it to start over", path);
+        free(payload);
+        return -1;
+    }
+
+    const unsigned char *p = payload;
+    int slices = header.slice_count + header.io_slice_count;
+    SliceRecord *records = slices > 0 ? malloc(slices * sizeof(SliceRecord)) : NULL;
+    if (slices > 0 && !records) {
+        sim_fail("Memory allocation failed while restoring checkpoint %s", path);
+        free(payload);
+        return -1;
+    }
+    if (slices > 0) memcpy(records, p, slices * sizeof(SliceRecord));
+    p += slices * sizeof(SliceRecord);
+    if (!timeline_import(&ctx->timeline, records, header.slice_count, header.io_slice_count, header.dropped)) {
+        sim_fail("Memory allocation failed while restoring checkpoint %s", path);
+        free(records);
+        free(payload);
+        return -1;
+    }
+    free(records);
+
+    size_t n = ctx->tracked;
+    if (n > 0) {
+        memcpy(ctx->first_run, p, n * sizeof(sim_time_t));
+        memcpy(ctx->completion, p + n * sizeof(sim_time_t), n * sizeof(sim_time_t));
+        memcpy(ctx->executed, p + 2 * n * sizeof(sim_time_t), n * sizeof(sim_time_t));
+        p += 3 * n * sizeof(sim_time_t);
+    }
+    ctx->busy = header.busy;
+
+    checkpoint_load_state(ck, p);
+    free(payload);
+
+    /* Whatever the run logged before this step is written again from here. */
+    if (ctx->log.file) {
+        fflush(ctx->log.file);
+        if (ftruncate(fileno(ctx->log.file), header.log_offset) != 0 ||
+            fseek(ctx->log.file, header.log_offset, SEEK_SET) != 0) {
+            sim_fail("Could not rewind log file %s", ctx->log.path);
+            return -1;
+        }
+        ctx->log.body_start = header.body_start;
+    }
+    return 0;
+}
+
+
+int checkpoint_poll(Checkpoint *ck) {
+    SimContext *ctx = sim_current();
+    if (ck->failed) return 1;
+    if (ctx->seek) return snapshot_seek_step(ctx->seek, ck);
+
+    int first = !ck->started;
+    if (first) {
+        ck->started = 1;
+        if (ctx->checkpoint.resume) {
+            ctx->checkpoint.resume = 0;
+            if (checkpoint_restore(ck, ctx) != 0) {
+                ck->failed = 1;
+                return 1;
+            }
+        }
+    }
+    if (ctx->snapshots) snapshot_record(ctx->snapshots, ck);
+
+    if (ctx->checkpoint.path[0] == '\0') return 0;
+    double now = now_seconds();
+    if (first) ck->last = now;
+    else if (now - ck->last >= ctx->checkpoint.interval) {
+        checkpoint_write(ck, ctx);
+        ck->last = now;
+    }
+    return 0;
+}
+
+
+void checkpoint_end(Checkpoint *ck) {
+    if (!ck->enabled || ck->failed) return;
+    SimContext *ctx = sim_current();
+    if (ctx->seek) snapshot_seek_end(ctx->seek, ck);
+    if (ctx->checkpoint.path[0] != '\0') remove(ctx->checkpoint.path);
+}
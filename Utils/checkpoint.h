@@ -0,0 +1,129 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef CHECKPOINT_H
+
+#define CHECKPOINT_H
+
+#include <stddef.h>
+#include "../Config/types.h"
+#include "./engine.h"
+
+#define CHECKPOINT_MAX_REGIONS 64
+#define CHECKPOINT_MAX_QUEUES 4
+
+typedef enum {
+    CHECKPOINT_RAW,
+    CHECKPOINT_PCBS,        /* saved without their I/O operations and ID pointers */
+    CHECKPOINT_PCB_REF      /* a PCB pointer, saved as an index */
+} CheckpointRegionKind;
+
+typedef struct {
+    CheckpointRegionKind kind;
+    void *data;
+    size_t size;            /* bytes, or the number of PCBs of the array */
+    PCB *base;              /* array a CHECKPOINT_PCB_REF points into */
+} CheckpointRegion;
+
+typedef struct ReadyQueue ReadyQueue;
+
+typedef enum {
+    CHECKPOINT_QUEUE_READY,
+    CHECKPOINT_QUEUE_IO,
+    CHECKPOINT_QUEUE_OTHER
+} CheckpointQueueRole;
+
+/* A queue of the run, listed when its state is read back (Utils/snapshot.h). */
+typedef struct {
+    const char *name;
+    CheckpointQueueRole role;
+    ReadyQueue *queue;
+    const sim_time_t *clock;    /* I/O keyed by due time on this clock; NULL: PCB countdowns */
+} CheckpointQueue;
+
+/* The processes of the run: its PCBs, or the arrays of a ProcessState. */
+typedef struct {
+    int count;
+    PCB *pcbs;
+    sim_time_t *remaining;
+    sim_time_t *executed;
+    int *next_io;
+    int *finished;
+} CheckpointProcesses;
+
+/*
+ * State of one run that a checkpoint saves. An algorithm registers its
+ * loop variables and the memory of the structures it works on, then calls
+ * checkpoint_step at the top of every step of its main loop. Along with
+ * the regions, a checkpoint holds the timeline, the CPU usage and the
+ * length of the log of the current context.
+ *
+ * Checkpoints are only taken when the current context asks for them (see
+ * sim_context_set_checkpoint). The first step of a run resumed from a
+ * checkpoint overwrites every region with what was saved, and the run
+ * carries on from there as if it had never stopped.
+ *
+ * The same regions give the in-memory snapshots of a context recording
+ * them, and the clock, arrivals, processes and queues registered besides
+ * say what the saved bytes mean (Utils/snapshot.h).
+ */
+typedef struct {
+    int enabled;
+    int started;
+    int failed;             /* a region did not fit or the restore failed */
+    double last;            /* wall clock of the last checkpoint, in seconds */
+    int count;
+    CheckpointRegion regions[CHECKPOINT_MAX_REGIONS];
+
+    sim_time_t *clock;
+    ArrivalStream *arrivals;
+    CheckpointProcesses processes;
+    int queue_count;
+    CheckpointQueue queues[CHECKPOINT_MAX_QUEUES];
+} Checkpoint;
+
+void checkpoint_begin(Checkpoint *ck);
+
+void checkpoint_add(Checkpoint *ck, void *data, size_t size);
+
+/* The time of the loop, which the steps are taken at. */
+void checkpoint_add_clock(Checkpoint *ck, sim_time_t *clock);
+
+void checkpoint_add_arrivals(Checkpoint *ck, ArrivalStream *arrivals);
+
+void checkpoint_add_pcbs(Checkpoint *ck, PCB *pcbs, int count);
+
+void checkpoint_add_pcb_ref(Checkpoint *ck, PCB **ref, PCB *base, int count);
+
+void checkpoint_add_queue(Checkpoint *ck, const char *name, CheckpointQueueRole role,
+                          ReadyQueue *queue, const sim_time_t *clock);
+
+/* Bytes of the registered regions, which the two functions below copy out of and back into. */
+size_t checkpoint_state_size(const Checkpoint *ck);
+
+void checkpoint_save_state(const Checkpoint *ck, unsigned char *buffer);
+
+void checkpoint_load_state(Checkpoint *ck, const unsigned char *buffer);
+
+/* Hash of the kind and size of every region. */
+unsigned long long checkpoint_layout(const Checkpoint *ck);
+
+/* 1 when the run is to stop, which a failed checkpoint reported through sim_fail. */
+int checkpoint_poll(Checkpoint *ck);
+
+/* Removes the checkpoint once the run is complete; a failed run keeps it. */
+void checkpoint_end(Checkpoint *ck);
+
+/* 1 if path holds an intact checkpoint of the run key, with the length of its log. */
+int checkpoint_probe(const char *path, unsigned long long key, long *log_offset);
+
+/* 1 when the run is to stop at this step. */
+static inline int checkpoint_step(Checkpoint *ck) {
+    return ck->enabled ? checkpoint_poll(ck) : 0;
+}
+
+#endif
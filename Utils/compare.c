@@ -0,0 +1,85 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <time.h>
+#include "compare.h"
+
+
+typedef struct {
+    const Config *config;
+    const SchedulerParams *params;
+    const char *config_file;
+    CompareResult *results;
+} CompareJob;
+
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+
+static void compare_one(void *arg, int job) {
+    CompareJob *batch = arg;
+    CompareResult *result = &batch->results[job];
+    double start = now_ms();
+
+    result->scheduler = &schedulers[job];
+    SimContext *ctx = sim_context_create(batch->config);
+    if (!ctx) {
+        result->failed = 1;
+        return;
+    }
+
+    sim_context_set_console(ctx, NULL);
+    if (batch->config_file) {
+        sim_context_open_log(ctx, result->scheduler->name, batch->config_file);
+    }
+    if (sim_run(ctx, result->scheduler->name, batch->params) != 0) {
+        result->failed = 1;
+        sim_context_destroy(ctx);
+        return;
+    }
+
+    sim_context_metrics(ctx, &result->metrics);
+    result->utilization = result->metrics.makespan > 0
+        ? (double)result->metrics.busy / result->metrics.makespan : 0;
+    sim_context_destroy(ctx);
+    result->wall_ms = now_ms() - start;
+}
+
+
+void compare_schedulers(ThreadPool *pool, const Config *config, const SchedulerParams *params,
+                        const char *config_file, CompareResult *results) {
+    CompareJob batch = { config, params, config_file, results };
+
+    for (int i = 0; i < scheduler_count; i++) {
+        results[i] = (CompareResult){ &schedulers[i], {0}, 0, 0, 0 };
+    }
+    thread_pool_run(pool, scheduler_count, compare_one, &batch);
+}
+
+
+void compare_print_table(FILE *out, const CompareResult *results, int count) {
+    fprintf(out, "%-24s %8s %10s %10s %10s %10s %10s %6s %9s\n",
+            "algorithm", "finished", "makespan", "avg_wait", "max_wait",
+            "avg_turn", "avg_resp", "cpu%", "wall_ms");
+    for (int i = 0; i < count; i++) {
+        const CompareResult *r = &results[i];
+        if (r->failed) {
+            fprintf(out, "%-24s %8s\n", r->scheduler->name, "failed");
+            continue;
+        }
+        fprintf(out, "%-24s %8d %10lld %10.2f %10lld %10.2f %10.2f %6.1f %9.2f\n",
+                r->scheduler->name, r->metrics.finished, r->metrics.makespan,
+                r->metrics.avg_waiting, r->metrics.max_waiting,
+                r->metrics.avg_turnaround, r->metrics.avg_response,
+                100.0 * r->utilization, r->wall_ms);
+    }
+}
@@ -0,0 +1,36 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef COMPARE_H
+
+#define COMPARE_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sim_context.h"
+#include "./thread_pool.h"
+
+typedef struct {
+    const Scheduler *scheduler;
+    SimMetrics metrics;
+    double utilization;     /* busy / makespan */
+    double wall_ms;         /* time the run took on its worker */
+    int failed;             /* the run gave up; its metrics are zero */
+} CompareResult;
+
+/*
+ * Runs every scheduler of the table on its own context, in parallel on
+ * the pool, and fills results[scheduler_count] in table order. With a
+ * config_file name each run writes its usual log in output/.
+ */
+void compare_schedulers(ThreadPool *pool, const Config *config, const SchedulerParams *params,
+                        const char *config_file, CompareResult *results);
+
+void compare_print_table(FILE *out, const CompareResult *results, int count);
+
+#endif
@@ -0,0 +1,29 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stddef.h>
+#include "./engine.h"
+
+
+_Thread_local sim_time_t engine_horizon = NO_EVENT;
+
+
+void arrival_stream_start(ArrivalStream *a, Config *config) {
+    config_sort_arrivals(config);
+    a->processes = config->processes;
+    a->order = config->arrival_order;
+    a->count = config->process_count;
+    a->next = 0;
+}
+
+
+void arrival_stream_ranks(const ArrivalStream *a, int *rank) {
+    for (int k = 0; k < a->count; k++) {
+        rank[a->order[k]] = k;
+    }
+}
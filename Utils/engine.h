@@ -0,0 +1,144 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef ENGINE_H
+
+#define ENGINE_H
+
+#include <limits.h>
+#include "../Config/config.h"
+#include "../Config/types.h"
+
+#define NO_EVENT LLONG_MAX
+
+/*
+ * Next-event engine shared by the schedulers.
+ * After simulating tick `time`, each algorithm schedules the ticks at which
+ * its state can change again (arrival, I/O completion, burst end, quantum
+ * expiry). Every tick strictly before `next_event` is quiet and can be
+ * fast-forwarded in one step instead of being rescanned.
+ */
+typedef struct {
+    sim_time_t time;
+    sim_time_t next_event;
+} Engine;
+
+/*
+ * Processes in arrival order, consumed through a cursor so that admitting
+ * the arrivals of a run costs O(process_count) in total.
+ */
+typedef struct {
+    const PROCESS *processes;
+    const int *order;
+    int count;
+    int next;
+} ArrivalStream;
+
+void arrival_stream_start(ArrivalStream *a, Config *config);
+
+/*
+ * rank[i] = position of process i in the stream, which orders the
+ * processes by (arrival_time, index) in a single int.
+ */
+void arrival_stream_ranks(const ArrivalStream *a, int *rank);
+
+/*
+ * Tick no fast-forward of the thread skips over, so that a run asked for
+ * its state at that time has a step there; NO_EVENT outside of such runs.
+ * It only shortens a fast-forward towards a known event.
+ */
+extern _Thread_local sim_time_t engine_horizon;
+
+/*
+ * The helpers below run on every simulated event. They are defined here
+ * so that each scheduler loop is compiled with them inlined.
+ */
+
+/* Next process arriving at or before `time`, or -1. */
+static inline int arrival_stream_pop(ArrivalStream *a, sim_time_t time) {
+    if (a->next >= a->count || a->processes[a->order[a->next]].arrival_time > time) {
+        return -1;
+    }
+    return a->order[a->next++];
+}
+
+static inline sim_time_t arrival_stream_next_time(ArrivalStream *a) {
+    if (a->next >= a->count) {
+        return NO_EVENT;
+    }
+    return a->processes[a->order[a->next]].arrival_time;
+}
+
+static inline int arrival_stream_pending(ArrivalStream *a) {
+    return a->count - a->next;
+}
+
+static inline void engine_start(Engine *e, sim_time_t time) {
+    e->time = time;
+    e->next_event = NO_EVENT;
+}
+
+static inline void engine_schedule(Engine *e, sim_time_t tick) {
+    if (tick > e->time && tick < e->next_event) {
+        e->next_event = tick;
+    }
+}
+
+/* Assumes every arrival up to e->time has already been popped. */
+static inline void engine_schedule_arrival(Engine *e, ArrivalStream *arrivals) {
+    engine_schedule(e, arrival_stream_next_time(arrivals));
+}
+
+/*
+ * The running process executes one unit per tick starting at time + 1.
+ * Schedules the tick during which it finishes or reaches its next I/O.
+ * exact_io selects between the `executed == start_time` and the
+ * `executed >= start_time` trigger used by the different algorithms.
+ */
+static inline void engine_schedule_burst(Engine *e, sim_time_t remaining, sim_time_t executed, const IO_OPERATION *next_io, int exact_io) {
+    sim_time_t ticks = remaining > 1 ? remaining : 1;
+
+    if (next_io != NULL) {
+        sim_time_t to_io = next_io->start_time - executed;
+        if (!exact_io && to_io < 1) {
+            to_io = 1;
+        }
+        if (to_io >= 1 && to_io < ticks) {
+            ticks = to_io;
+        }
+    }
+    engine_schedule(e, e->time + ticks);
+}
+
+static inline void engine_schedule_quantum(Engine *e, sim_time_t used, sim_time_t quantum) {
+    sim_time_t left = quantum - used;
+    engine_schedule(e, e->time + (left > 1 ? left : 1));
+}
+
+/*
+ * Number of ticks between `time` and the next event that need no
+ * scheduling decision. Without any known event the caller falls back to
+ * stepping one tick at a time.
+ */
+static inline sim_time_t engine_quiet_ticks(Engine *e) {
+    if (e->next_event == NO_EVENT) {
+        return 0;
+    }
+    if (engine_horizon > e->time && engine_horizon < e->next_event) {
+        return engine_horizon - e->time - 1;
+    }
+    return e->next_event - e->time - 1;
+}
+
+static inline const IO_OPERATION* pcb_next_io(PCB *p) {
+    if (p->io_index >= p->process.io_count) {
+        return NULL;
+    }
+    return &p->io_operations[p->io_index];
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "./io_timer.h"
+#include "./engine.h"
+#include "./ready_queue.h"
+
+/* Min-heap of blocked processes ordered by (due, order, arming order). */
+struct IoTimer {
+    ReadyQueue *heap;
+};
+
+
+IoTimer* io_timer_create(int capacity) {
+    IoTimer *t = malloc(sizeof(IoTimer));
+    if (t == NULL) return NULL;
+    t->heap = ready_queue_create(READY_HEAP, capacity, 0);
+    if (t->heap == NULL) {
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+void io_timer_destroy(IoTimer *t) {
+    if (!t) return;
+    ready_queue_destroy(t->heap);
+    free(t);
+}
+
+sim_time_t io_timer_due(sim_time_t now, sim_time_t countdown) {
+    return now + (countdown > 1 ? countdown : 1);
+}
+
+sim_time_t io_timer_due_serial(sim_time_t now, sim_time_t *busy_until, sim_time_t countdown) {
+    *busy_until = io_timer_due(*busy_until > now ? *busy_until : now, countdown);
+    return *busy_until;
+}
+
+void io_timer_arm(IoTimer *t, int process, sim_time_t due, long long order) {
+    ready_queue_remove(t->heap, process);
+    ready_queue_push(t->heap, process, due, order);
+}
+
+void io_timer_cancel(IoTimer *t, int process) {
+    ready_queue_remove(t->heap, process);
+}
+
+/* Next process whose I/O completes at or before `now`, or -1. */
+int io_timer_pop_due(IoTimer *t, sim_time_t now) {
+    int process = ready_queue_peek(t->heap);
+    if (process == -1 || ready_queue_key(t->heap, process) > now) {
+        return -1;
+    }
+    ready_queue_pop(t->heap);
+    return process;
+}
+
+/* Clock value of the earliest pending completion, NO_EVENT when idle. */
+sim_time_t io_timer_next(IoTimer *t) {
+    int process = ready_queue_peek(t->heap);
+    if (process == -1) {
+        return NO_EVENT;
+    }
+    return ready_queue_key(t->heap, process);
+}
+
+/* Process whose I/O completes first, or -1. */
+int io_timer_first(IoTimer *t) {
+    return ready_queue_peek(t->heap);
+}
+
+int io_timer_pending(IoTimer *t) {
+    return ready_queue_size(t->heap);
+}
+
+void io_timer_checkpoint(IoTimer *t, Checkpoint *ck, const sim_time_t *clock) {
+    ready_queue_checkpoint(t->heap, ck);
+    checkpoint_add_queue(ck, "io", CHECKPOINT_QUEUE_IO, t->heap, clock);
+}
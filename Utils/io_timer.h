@@ -0,0 +1,56 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef IO_TIMER_H
+
+#define IO_TIMER_H
+
+#include "../Config/types.h"
+#include "./checkpoint.h"
+
+/*
+ * Pending I/O completions of the blocked processes, keyed by the clock
+ * value at which they complete. Instead of decrementing a countdown for
+ * every blocked process on every tick, an algorithm arms the timer when
+ * the I/O starts and pops the processes that are due.
+ *
+ * A countdown started at `now` and decremented once per following clock
+ * step completes at io_timer_due(now, countdown). Processes due at the
+ * same time are popped by increasing `order`, then in arming order.
+ *
+ * A device serving one I/O at a time chains the due times instead: with
+ * io_timer_due_serial, an I/O armed while another is pending starts its
+ * countdown on the tick after the previous one completes.
+ */
+typedef struct IoTimer IoTimer;
+
+/* NULL if the memory cannot be allocated. */
+IoTimer* io_timer_create(int capacity);
+
+void io_timer_destroy(IoTimer *t);
+
+sim_time_t io_timer_due(sim_time_t now, sim_time_t countdown);
+
+/* The due time of a countdown queued behind the I/O due at *busy_until, which moves to it. */
+sim_time_t io_timer_due_serial(sim_time_t now, sim_time_t *busy_until, sim_time_t countdown);
+
+void io_timer_arm(IoTimer *t, int process, sim_time_t due, long long order);
+
+void io_timer_cancel(IoTimer *t, int process);
+
+int io_timer_pop_due(IoTimer *t, sim_time_t now);
+
+sim_time_t io_timer_next(IoTimer *t);
+
+int io_timer_first(IoTimer *t);
+
+int io_timer_pending(IoTimer *t);
+
+/* The due times are on clock, which the I/O left is counted from. */
+void io_timer_checkpoint(IoTimer *t, Checkpoint *ck, const sim_time_t *clock);
+
+#endif
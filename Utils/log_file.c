@@ -1,92 +1,140 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
- 
-#include <stdio.h>
-#include <stdlib.h>
-#include <stdarg.h>
-#include <string.h>
-#include <time.h>
-#include <sys/stat.h>
-#include <sys/types.h>
-
-char current_log_path[512];
-FILE *log_file = NULL;
-
-
-void remove_extension(char *filename) {
-    char *dot = strrchr(filename, '.');
-    if (dot != NULL) {
-        *dot = '\0'; 
-    }
-}
-
-int init_log(const char *algo_name,  const char *config_file) {
-    FILE *log_file = NULL;
-
-    #ifdef _WIN32
-        mkdir("output");
-    #else
-        mkdir("output", 0755);
-    #endif
-    
-    char config_name[256];
-    strncpy(config_name, config_file, sizeof(config_name) - 1);
-    config_name[sizeof(config_name) - 1] = '\0';
-    remove_extension(config_name);
-
-    snprintf(current_log_path, sizeof(current_log_path), "output/%s_%s.log", algo_name, config_name);
-    
-
-    log_file = fopen(current_log_path, "w");
-    if (log_file == NULL) {
-        fprintf(stderr, "Error: Could not create log file %s\n", current_log_path);
-        return -1;
-    }
-    
-
-    time_t now = time(NULL);
-    fprintf(log_file, "**********************************************************\n");
-    fprintf(log_file, "Creation Time: %s", ctime(&now));
-    fprintf(log_file, "**********************************************************\n");
-    fprintf(log_file, "Algorithm: %s\n", algo_name);
-    fprintf(log_file, "Config File Used: %s\n", strcat(config_name,".txt"));
-    fprintf(log_file, "**********************************************************\n\n");
-    fflush(log_file);
-    
-    printf("Log file created: %s\n\n", current_log_path);
-    return 0;
-}
-
-void close_log() {
-    if (log_file != NULL) {
-        fprintf(log_file, "\n**********************************************************\n");
-        fprintf(log_file, "Execution completed\n");
-        fprintf(log_file, "**********************************************************\n\n\n");
-        fclose(log_file);
-        log_file = NULL;
-    }
-}
-
-
-int log_print(const char *format, ...) {
-    va_list args;
-
-    log_file = fopen(current_log_path, "a");
-    if (log_file == NULL) {
-        fprintf(stderr, "Error: Could not create log file %s\n", current_log_path);
-        return -1;
-    }
-    
-    va_start(args, format);
-    vfprintf(log_file, format, args);
-    fflush(log_file);
-    va_end(args);
-    return  0;
-    
-}
-
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+ 
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "log_file.h"
+#include "sim_context.h"
+
+
+void remove_extension(char *filename) {
+    char *dot = strrchr(filename, '.');
+    if (dot != NULL) {
+        *dot = '\0'; 
+    }
+}
+
+/* Closes the sink and names its file; config_name gets the configuration without extension. */
+static void log_sink_path(LogSink *sink, const char *algo_name, const char *config_file, char *config_name, size_t size) {
+    strncpy(config_name, config_file, size - 1);
+    config_name[size - 1] = '\0';
+    remove_extension(config_name);
+
+    if (sink->file != NULL) {
+        fclose(sink->file);
+        sink->file = NULL;
+    }
+
+    #ifdef _WIN32
+        mkdir("output");
+    #else
+        mkdir("output", 0755);
+    #endif
+
+    snprintf(sink->path, sizeof(sink->path), "output/%s_%s.log", algo_name, config_name);
+}
+
+int log_sink_open(LogSink *sink, const char *algo_name, const char *config_file) {
+    char config_name[256];
+    log_sink_path(sink, algo_name, config_file, config_name, sizeof(config_name));
+    
+
+    sink->file = fopen(sink->path, "w");
+    if (sink->file == NULL) {
+        fprintf(stderr, "Error: Could not create log file %s\n", sink->path);
+        return -1;
+    }
+    
+
+    time_t now = time(NULL);
+    char stamp[32];
+    #ifdef _WIN32
+        ctime_s(stamp, sizeof(stamp), &now);
+    #else
+        ctime_r(&now, stamp);
+    #endif
+    fprintf(sink->file, "**********************************************************\n");
+    fprintf(sink->file, "Creation Time: %s", stamp);
+    fprintf(sink->file, "**********************************************************\n");
+    fprintf(sink->file, "Algorithm: %s\n", algo_name);
+    fprintf(sink->file, "Config File Used: %s\n", strcat(config_name,".txt"));
+    fprintf(sink->file, "**********************************************************\n\n");
+    fflush(sink->file);
+    sink->body_start = ftell(sink->file);
+    return 0;
+}
+
+int log_sink_reopen(LogSink *sink, const char *algo_name, const char *config_file, long length) {
+    char config_name[256];
+    log_sink_path(sink, algo_name, config_file, config_name, sizeof(config_name));
+
+    sink->file = fopen(sink->path, "r+");
+    if (sink->file == NULL) return -1;
+
+    if (fseek(sink->file, 0, SEEK_END) != 0 || ftell(sink->file) < length ||
+        ftruncate(fileno(sink->file), length) != 0 || fseek(sink->file, length, SEEK_SET) != 0) {
+        fclose(sink->file);
+        sink->file = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+void log_sink_close(LogSink *sink) {
+    if (sink->file != NULL) {
+        fprintf(sink->file, "\n**********************************************************\n");
+        fprintf(sink->file, "Execution completed\n");
+        fprintf(sink->file, "**********************************************************\n\n\n");
+        fclose(sink->file);
+        sink->file = NULL;
+    }
+}
+
+int log_sink_vprint(LogSink *sink, const char *format, va_list args) {
+    if (sink->path[0] == '\0') return 0;
+
+    if (sink->file == NULL) {
+        sink->file = fopen(sink->path, "a");
+    }
+    if (sink->file == NULL) {
+        fprintf(stderr, "Error: Could not create log file %s\n", sink->path);
+        return -1;
+    }
+    
+    vfprintf(sink->file, format, args);
+    return  0;
+}
+
+
+int init_log(const char *algo_name,  const char *config_file) {
+    LogSink *sink = &sim_current()->log;
+    if (log_sink_open(sink, algo_name, config_file) != 0) return -1;
+
+    sim_printf("Log file created: %s\n\n", sink->path);
+    return 0;
+}
+
+void close_log() {
+    log_sink_close(&sim_current()->log);
+}
+
+
+int log_print(const char *format, ...) {
+    va_list args;
+
+    va_start(args, format);
+    int result = log_sink_vprint(&sim_current()->log, format, args);
+    va_end(args);
+    return result;
+}
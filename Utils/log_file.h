@@ -1,21 +1,44 @@
-/*
- * Simulateur d'Ordonnancement de Processus
- * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
- *
- * Licensed under the MIT License
- * See LICENSE file in the project root for full license information.
- */
-#ifndef LOGFILE_H
-
-#define LOGFILE_H
-
-
-void remove_extension(char *filename);
-
-int init_log(const char *algo_name,  const char *config_file);
-
-void close_log();
-
-int log_print(const char *format, ...);
-
-#endif
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef LOGFILE_H
+
+#define LOGFILE_H
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/* Log file of one simulation context; an empty path means no log. */
+typedef struct {
+    FILE *file;
+    char path[512];
+    long body_start;        /* offset of the run's output, after the header */
+} LogSink;
+
+void remove_extension(char *filename);
+
+int log_sink_open(LogSink *sink, const char *algo_name, const char *config_file);
+
+/*
+ * Opens the log a previous run of the same algorithm and configuration
+ * left, cut back to its first length bytes, to carry on writing it.
+ */
+int log_sink_reopen(LogSink *sink, const char *algo_name, const char *config_file, long length);
+
+void log_sink_close(LogSink *sink);
+
+/* Buffered: the file is only flushed when a checkpoint is written and when it is closed. */
+int log_sink_vprint(LogSink *sink, const char *format, va_list args);
+
+/* The same operations on the log of the current simulation context. */
+int init_log(const char *algo_name,  const char *config_file);
+
+void close_log();
+
+int log_print(const char *format, ...);
+
+#endif
@@ -0,0 +1,294 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "matrix.h"
+#include "thread_pool.h"
+
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+
+static int matrix_runs(const Matrix *m) {
+    return m->config_count * m->scheduler_count;
+}
+
+
+Matrix* matrix_create(const char *dir, const Scheduler **schedulers, int scheduler_count,
+                      const SchedulerParams *params, int write_logs) {
+    Matrix *m = calloc(1, sizeof(Matrix));
+    if (!m) return NULL;
+
+    snprintf(m->dir, sizeof(m->dir), "%s", dir);
+    m->config_names = malloc(MATRIX_MAX_CONFIGS * sizeof(*m->config_names));
+    m->schedulers = malloc(scheduler_count * sizeof(*m->schedulers));
+    if (!m->config_names || !m->schedulers) {
+        matrix_destroy(m);
+        return NULL;
+    }
+    memcpy(m->schedulers, schedulers, scheduler_count * sizeof(*m->schedulers));
+    m->scheduler_count = scheduler_count;
+    m->params = *params;
+    m->write_logs = write_logs;
+
+    m->config_count = config_list_files(dir, m->config_names, MATRIX_MAX_CONFIGS);
+    if (m->config_count == 0) {
+        matrix_destroy(m);
+        return NULL;
+    }
+
+    m->configs = calloc(m->config_count, sizeof(Config));
+    m->table_size = sizeof(MatrixTable) + (size_t)matrix_runs(m) * sizeof(MatrixCell);
+    m->table = mmap(NULL, m->table_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (m->table == MAP_FAILED) m->table = NULL;
+    if (!m->configs || !m->table) {
+        matrix_destroy(m);
+        return NULL;
+    }
+
+    /* Loaded once here; the workers inherit them when they are forked. */
+    for (int c = 0; c < m->config_count; c++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", dir, m->config_names[c]);
+        int loaded = load_config(path, &m->configs[c]);
+        for (int s = 0; s < m->scheduler_count; s++) {
+            m->table->cells[c * m->scheduler_count + s].status = loaded ? MATRIX_PENDING : MATRIX_LOAD_FAILED;
+        }
+    }
+    return m;
+}
+
+
+void matrix_destroy(Matrix *m) {
+    if (!m) return;
+    if (m->configs) {
+        for (int c = 0; c < m->config_count; c++) config_release(&m->configs[c]);
+    }
+    if (m->table) munmap(m->table, m->table_size);
+    free(m->configs);
+    free(m->config_names);
+    free(m->schedulers);
+    free(m);
+}
+
+
+/* 0 if the run was timed out before the worker could publish it. */
+static int matrix_finish(MatrixCell *cell, int status) {
+    int running = MATRIX_RUNNING;
+    return atomic_compare_exchange_strong(&cell->status, &running, status);
+}
+
+
+/* Returns 0 if the parent timed the run out meanwhile. */
+static int matrix_run_cell(Matrix *m, int job) {
+    MatrixCell *cell = &m->table->cells[job];
+    const Config *config = &m->configs[job / m->scheduler_count];
+    const Scheduler *scheduler = m->schedulers[job % m->scheduler_count];
+    double start = now_ms();
+
+    cell->worker = getpid();
+    cell->started_ms = start;
+    atomic_store(&cell->status, MATRIX_RUNNING);
+
+    SimContext *ctx = sim_context_create(config);
+    if (!ctx) return matrix_finish(cell, MATRIX_FAILED);
+    sim_context_set_console(ctx, NULL);
+    if (m->write_logs) {
+        sim_context_open_log(ctx, scheduler->name, m->config_names[job / m->scheduler_count]);
+    }
+    if (sim_run(ctx, scheduler->name, &m->params) != 0) {
+        sim_context_destroy(ctx);
+        cell->wall_ms = now_ms() - start;
+        return matrix_finish(cell, MATRIX_FAILED);
+    }
+
+    sim_context_metrics(ctx, &cell->metrics);
+    cell->utilization = cell->metrics.makespan > 0
+        ? (double)cell->metrics.busy / cell->metrics.makespan : 0;
+    sim_context_destroy(ctx);
+    cell->wall_ms = now_ms() - start;
+    return matrix_finish(cell, MATRIX_DONE);
+}
+
+
+/*
+ * Claims runs until none is left; runs in a forked worker. A worker whose
+ * run was timed out is about to be killed and claims no other: exit
+ * status 1.
+ */
+static int matrix_worker(Matrix *m) {
+    int runs = matrix_runs(m);
+    int job;
+    while ((job = atomic_fetch_add(&m->table->next, 1)) < runs) {
+        if (atomic_load(&m->table->cells[job].status) != MATRIX_PENDING) continue;
+        if (!matrix_run_cell(m, job)) return 1;
+    }
+    return 0;
+}
+
+
+static pid_t matrix_spawn(Matrix *m) {
+    pid_t pid = fork();
+    if (pid == 0) _exit(matrix_worker(m));
+    return pid;
+}
+
+
+/* Kills the workers of the runs started before the deadline. */
+static void matrix_expire(Matrix *m, double deadline) {
+    int runs = matrix_runs(m);
+    for (int job = 0; job < runs; job++) {
+        MatrixCell *cell = &m->table->cells[job];
+        if (atomic_load(&cell->status) != MATRIX_RUNNING || cell->started_ms >= deadline) continue;
+        pid_t worker = cell->worker;
+        int running = MATRIX_RUNNING;
+        if (!atomic_compare_exchange_strong(&cell->status, &running, MATRIX_TIMED_OUT)) continue;
+        if (cell->worker == worker) kill(worker, SIGKILL);
+    }
+}
+
+
+int matrix_run(Matrix *m, int workers, double timeout) {
+    int runs = matrix_runs(m);
+    if (workers <= 0) workers = thread_pool_default_size();
+    if (workers > runs) workers = runs;
+
+    double start = now_ms();
+    m->timeout = timeout;
+    atomic_store(&m->table->next, 0);
+
+    /* Buffered output would otherwise be written again by every worker. */
+    fflush(NULL);
+
+    int alive = 0;
+    for (int i = 0; i < workers; i++) {
+        if (matrix_spawn(m) > 0) alive++;
+    }
+    m->workers = alive;
+    if (alive == 0) matrix_worker(m);
+
+    /* With a timeout the parent polls its workers instead of blocking on them. */
+    const struct timespec poll = { 0, 10 * 1000 * 1000 };
+    while (alive > 0) {
+        int wstatus;
+        pid_t pid = waitpid(-1, &wstatus, timeout > 0 ? WNOHANG : 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (pid == 0) {
+            matrix_expire(m, now_ms() - timeout * 1000);
+            nanosleep(&poll, NULL);
+            continue;
+        }
+        alive--;
+        if (WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0) continue;
+
+        for (int job = 0; job < runs; job++) {
+            MatrixCell *cell = &m->table->cells[job];
+            if (atomic_load(&cell->status) == MATRIX_RUNNING && cell->worker == pid) {
+                atomic_store(&cell->status, MATRIX_CRASHED);
+                cell->signal = WIFSIGNALED(wstatus) ? WTERMSIG(wstatus) : 0;
+            }
+        }
+        if (atomic_load(&m->table->next) < runs && matrix_spawn(m) > 0) alive++;
+    }
+
+    /* Runs no worker got to, e.g. when forking failed midway. */
+    for (int job = 0; job < runs; job++) {
+        if (m->table->cells[job].status == MATRIX_PENDING) matrix_run_cell(m, job);
+    }
+    m->wall_ms = now_ms() - start;
+
+    int failed = 0;
+    for (int job = 0; job < runs; job++) {
+        if (m->table->cells[job].status != MATRIX_DONE) failed++;
+    }
+    return failed;
+}
+
+
+static const char* matrix_status_name(const MatrixCell *cell) {
+    switch (cell->status) {
+        case MATRIX_DONE: return "ok";
+        case MATRIX_LOAD_FAILED: return "load_failed";
+        case MATRIX_CRASHED: return "crashed";
+        case MATRIX_FAILED: return "failed";
+        case MATRIX_TIMED_OUT: return "timeout";
+        default: return "not_run";
+    }
+}
+
+
+void matrix_print(FILE *out, const Matrix *m) {
+    int runs = matrix_runs(m);
+    fprintf(out, "%d configurations x %d algorithms in %s: %d runs on %d worker processes, %.1f ms\n",
+            m->config_count, m->scheduler_count, m->dir, runs, m->workers, m->wall_ms);
+    fprintf(out, "quantum: %d, aging_interval: %d, max_priority: %d\n\n",
+            m->params.quantum, m->params.aging_interval, m->params.max_priority);
+
+    fprintf(out, "%-24s %-24s %-11s %9s %8s %10s %10s %10s %10s %10s %10s %6s %9s\n",
+            "config", "algorithm", "status", "processes", "finished", "makespan", "avg_wait",
+            "max_wait", "p95_wait", "avg_turn", "avg_resp", "cpu%", "wall_ms");
+    for (int job = 0; job < runs; job++) {
+        const MatrixCell *cell = &m->table->cells[job];
+        int c = job / m->scheduler_count;
+        const char *config = m->config_names[c];
+        const char *algorithm = m->schedulers[job % m->scheduler_count]->name;
+
+        if (cell->status != MATRIX_DONE) {
+            fprintf(out, "%-24s %-24s %-11s", config, algorithm, matrix_status_name(cell));
+            if (cell->signal) fprintf(out, " (signal %d)", cell->signal);
+            if (cell->status == MATRIX_TIMED_OUT) fprintf(out, " (over %g s)", m->timeout);
+            fprintf(out, "\n");
+            continue;
+        }
+        const SimMetrics *r = &cell->metrics;
+        fprintf(out, "%-24s %-24s %-11s %9d %8d %10lld %10.2f %10lld %10lld %10.2f %10.2f %6.1f %9.2f\n",
+                config, algorithm, "ok", m->configs[c].process_count, r->finished, r->makespan,
+                r->avg_waiting, r->max_waiting, r->p95_waiting, r->avg_turnaround, r->avg_response,
+                100.0 * cell->utilization, cell->wall_ms);
+    }
+
+    /* Means over the runs that completed, one line per algorithm. */
+    fprintf(out, "\n%-24s %6s %6s %10s %10s %10s %10s %10s %6s\n",
+            "algorithm", "ok", "failed", "unfinished", "makespan", "avg_wait", "avg_turn", "avg_resp", "cpu%");
+    for (int s = 0; s < m->scheduler_count; s++) {
+        int ok = 0, failed = 0, unfinished = 0;
+        double makespan = 0, waiting = 0, turnaround = 0, response = 0, utilization = 0;
+        for (int c = 0; c < m->config_count; c++) {
+            const MatrixCell *cell = &m->table->cells[c * m->scheduler_count + s];
+            if (cell->status != MATRIX_DONE) {
+                failed++;
+                continue;
+            }
+            ok++;
+            if (cell->metrics.finished < m->configs[c].process_count) unfinished++;
+            makespan += cell->metrics.makespan;
+            waiting += cell->metrics.avg_waiting;
+            turnaround += cell->metrics.avg_turnaround;
+            response += cell->metrics.avg_response;
+            utilization += cell->utilization;
+        }
+        int n = ok > 0 ? ok : 1;
+        fprintf(out, "%-24s %6d %6d %10d %10.2f %10.2f %10.2f %10.2f %6.1f\n",
+                m->schedulers[s]->name, ok, failed, unfinished, makespan / n, waiting / n,
+                turnaround / n, response / n, 100.0 * utilization / n);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef MATRIX_H
+
+#define MATRIX_H
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sim_context.h"
+
+#define MATRIX_MAX_CONFIGS 1000
+
+typedef enum {
+    MATRIX_PENDING,
+    MATRIX_RUNNING,
+    MATRIX_DONE,
+    MATRIX_LOAD_FAILED,
+    MATRIX_CRASHED,
+    MATRIX_FAILED,          /* sim_run gave up, see sim_fail */
+    MATRIX_TIMED_OUT        /* killed once it ran longer than the timeout */
+} MatrixStatus;
+
+/*
+ * A worker publishes a run by moving its status from RUNNING to DONE or
+ * FAILED, and the parent times it out by moving it from RUNNING to
+ * TIMED_OUT: whichever compare-exchange comes first owns the cell.
+ */
+typedef struct {
+    atomic_int status;
+    int worker;             /* pid of the process that ran it, set before RUNNING */
+    int signal;             /* signal that killed the worker, if it crashed */
+    double started_ms;      /* monotonic clock when the run started */
+    SimMetrics metrics;
+    double utilization;
+    double wall_ms;
+} MatrixCell;
+
+/* Lives in a shared mapping: the parent reads what the workers wrote. */
+typedef struct {
+    atomic_int next;        /* next run not claimed yet */
+    MatrixCell cells[];     /* config-major: cells[c * scheduler_count + s] */
+} MatrixTable;
+
+/*
+ * Every configuration file of a directory crossed with a set of
+ * schedulers. The runs are spread over forked worker processes, so a run
+ * that crashes or hangs only loses its own cell: the parent marks it and
+ * starts a new worker for the remaining runs.
+ */
+typedef struct {
+    char dir[512];
+    int config_count;
+    char (*config_names)[CONFIG_NAME_LEN];
+    Config *configs;
+    int scheduler_count;
+    const Scheduler **schedulers;
+    SchedulerParams params;
+    int write_logs;
+
+    MatrixTable *table;
+    size_t table_size;
+    int workers;
+    double timeout;         /* seconds, of the last matrix_run */
+    double wall_ms;
+} Matrix;
+
+/* Loads every configuration of dir; NULL if none is found. */
+Matrix* matrix_create(const char *dir, const Scheduler **schedulers, int scheduler_count,
+                      const SchedulerParams *params, int write_logs);
+
+void matrix_destroy(Matrix *m);
+
+/*
+ * workers <= 0 uses one per online CPU. A run taking more than timeout
+ * seconds of wall clock has its worker killed; timeout <= 0 waits for
+ * every run. Returns the number of failed runs.
+ */
+int matrix_run(Matrix *m, int workers, double timeout);
+
+void matrix_print(FILE *out, const Matrix *m);
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "monte_carlo.h"
+#include "sim_context.h"
+#include "rng.h"
+
+
+int parse_distribution(const char *text, Distribution *dist) {
+    char *end;
+
+    dist->a = 0;
+    dist->b = 0;
+    if (strcmp(text, "fixed") == 0) {
+        dist->kind = DIST_FIXED;
+        return 1;
+    }
+    if (strcmp(text, "exp") == 0) {
+        dist->kind = DIST_EXPONENTIAL;
+        return 1;
+    }
+    if (strncmp(text, "shift:", 6) == 0) {
+        dist->kind = DIST_SHIFT;
+        dist->a = strtod(text + 6, &end);
+        return end != text + 6 && *end == '\0' && dist->a >= 0;
+    }
+    if (strncmp(text, "scale:", 6) == 0) {
+        dist->kind = DIST_SCALE;
+        dist->a = strtod(text + 6, &end);
+        if (end == text + 6 || *end != ',') return 0;
+        const char *second = end + 1;
+        dist->b = strtod(second, &end);
+        return end != second && *end == '\0' && dist->a >= 0 && dist->b >= dist->a;
+    }
+    return 0;
+}
+
+
+static sim_time_t sample(const Distribution *dist, sim_time_t value, sim_time_t min, unsigned long long *state) {
+    double drawn;
+
+    switch (dist->kind) {
+        case DIST_SHIFT: {
+            sim_time_t range = (sim_time_t)dist->a;
+            drawn = (double)(value + (sim_time_t)(rng_next_double(state) * (2 * range + 1)) - range);
+            break;
+        }
+        case DIST_SCALE:
+            drawn = value * (dist->a + rng_next_double(state) * (dist->b - dist->a)) + 0.5;
+            break;
+        case DIST_EXPONENTIAL:
+            drawn = -value * log(1.0 - rng_next_double(state)) + 0.5;
+            break;
+        default:
+            return value;
+    }
+    return drawn < min ? min : (sim_time_t)drawn;
+}
+
+
+void workload_sample(Config *config, const WorkloadModel *model, unsigned long long *state) {
+    /* Gaps are taken in the template's arrival order. */
+    config_sort_arrivals(config);
+
+    sim_time_t previous_template = 0;
+    sim_time_t previous = 0;
+    for (int k = 0; k < config->process_count; k++) {
+        PROCESS *p = &config->processes[config->arrival_order[k]];
+        sim_time_t gap = p->arrival_time - previous_template;
+        previous_template = p->arrival_time;
+        previous += sample(&model->arrival, gap, 0, state);
+        p->arrival_time = previous;
+    }
+
+    for (int i = 0; i < config->process_count; i++) {
+        PROCESS *p = &config->processes[i];
+        p->execution_time = sample(&model->burst, p->execution_time, 1, state);
+
+        IO_OPERATION *io = process_io(config, p);
+        for (int k = 0; k < p->io_count; k++) {
+            io[k].duration = sample(&model->io_duration, io[k].duration, 1, state);
+        }
+    }
+}
+
+
+typedef struct {
+    MonteCarlo *mc;
+    const Config *config;
+    const WorkloadModel *model;
+    const SchedulerParams *params;
+} MonteCarloJob;
+
+
+static void replication_run(void *arg, int job) {
+    MonteCarloJob *batch = arg;
+    MonteCarlo *mc = batch->mc;
+    int replication = job / mc->scheduler_count;
+    const Scheduler *scheduler = mc->schedulers[job % mc->scheduler_count];
+    SweepResult *result = &mc->runs[job];
+
+    result->params = *batch->params;
+    SimContext *ctx = sim_context_create(batch->config);
+    if (!ctx) return;
+
+    unsigned long long state = rng_stream(mc->seed, (unsigned long long)replication);
+    workload_sample(&ctx->config, batch->model, &state);
+
+    sim_context_set_console(ctx, NULL);
+    /* A run that failed keeps zero metrics and counts as incomplete. */
+    if (sim_run(ctx, scheduler->name, &result->params) == 0) sim_context_metrics(ctx, &result->metrics);
+    result->utilization = result->metrics.makespan > 0
+        ? (double)result->metrics.busy / result->metrics.makespan : 0;
+    sim_context_destroy(ctx);
+}
+
+
+/* Two-sided 95% quantile of Student's t distribution. */
+static double student_t95(int df) {
+    static const double table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (df <= 0) return 0;
+    if (df <= 30) return table[df - 1];
+    if (df <= 60) return 2.000;
+    if (df <= 120) return 1.980;
+    return 1.960;
+}
+
+
+static void summarize(MonteCarlo *mc) {
+    int n = mc->replications;
+
+    for (int s = 0; s < mc->scheduler_count; s++) {
+        for (int r = 0; r < n; r++) {
+            if (mc->runs[r * mc->scheduler_count + s].metrics.finished < mc->process_count) {
+                mc->incomplete[s]++;
+            }
+        }
+        for (int m = 0; m < SWEEP_METRIC_COUNT; m++) {
+            double sum = 0, squares = 0;
+            for (int r = 0; r < n; r++) {
+                sum += sweep_metric_value(&mc->runs[r * mc->scheduler_count + s], (SweepMetric)m);
+            }
+            double mean = sum / n;
+            for (int r = 0; r < n; r++) {
+                double d = sweep_metric_value(&mc->runs[r * mc->scheduler_count + s], (SweepMetric)m) - mean;
+                squares += d * d;
+            }
+
+            MetricSummary *summary = &mc->summary[s * SWEEP_METRIC_COUNT + m];
+            summary->mean = mean;
+            summary->stddev = n > 1 ? sqrt(squares / (n - 1)) : 0;
+            double half = student_t95(n - 1) * summary->stddev / sqrt((double)n);
+            summary->ci_low = mean - half;
+            summary->ci_high = mean + half;
+        }
+    }
+}
+
+
+MonteCarlo* monte_carlo_run(ThreadPool *pool, const Config *config, const WorkloadModel *model,
+                            const Scheduler **schedulers, int scheduler_count,
+                            const SchedulerParams *params, int replications, unsigned long long seed) {
+    if (replications <= 0 || scheduler_count <= 0) return NULL;
+
+    MonteCarlo *mc = calloc(1, sizeof(MonteCarlo));
+    if (mc == NULL) {
+        fprintf(stderr, "Memory allocation failed for Monte Carlo run\n");
+        return NULL;
+    }
+    mc->replications = replications;
+    mc->scheduler_count = scheduler_count;
+    mc->seed = seed;
+    mc->process_count = config->process_count;
+    mc->schedulers = malloc(scheduler_count * sizeof(const Scheduler *));
+    mc->runs = calloc((size_t)replications * scheduler_count, sizeof(SweepResult));
+    mc->summary = calloc((size_t)scheduler_count * SWEEP_METRIC_COUNT, sizeof(MetricSummary));
+    mc->incomplete = calloc(scheduler_count, sizeof(int));
+    if (!mc->schedulers || !mc->runs || !mc->summary || !mc->incomplete) {
+        fprintf(stderr, "Memory allocation failed for %d replications\n", replications);
+        monte_carlo_destroy(mc);
+        return NULL;
+    }
+    memcpy(mc->schedulers, schedulers, scheduler_count * sizeof(const Scheduler *));
+
+    MonteCarloJob batch = { mc, config, model, params };
+    thread_pool_run(pool, replications * scheduler_count, replication_run, &batch);
+    summarize(mc);
+    return mc;
+}
+
+
+void monte_carlo_destroy(MonteCarlo *mc) {
+    if (!mc) return;
+    free(mc->schedulers);
+    free(mc->runs);
+    free(mc->summary);
+    free(mc->incomplete);
+    free(mc);
+}
+
+
+void monte_carlo_print(FILE *out, const MonteCarlo *mc) {
+    fprintf(out, "%d replications, seed %llu, mean [95%% confidence interval]\n",
+            mc->replications, mc->seed);
+
+    for (int s = 0; s < mc->scheduler_count; s++) {
+        fprintf(out, "\n%s", mc->schedulers[s]->name);
+        if (mc->incomplete[s] > 0) fprintf(out, " (%d runs left processes unfinished)", mc->incomplete[s]);
+        fprintf(out, "\n");
+
+        for (int m = 0; m < SWEEP_METRIC_COUNT; m++) {
+            const MetricSummary *summary = &mc->summary[s * SWEEP_METRIC_COUNT + m];
+            fprintf(out, "  %-15s %12.4f  [%12.4f, %12.4f]  sd %.4f\n", sweep_metric_names[m],
+                    summary->mean, summary->ci_low, summary->ci_high, summary->stddev);
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef MONTE_CARLO_H
+
+#define MONTE_CARLO_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sweep.h"
+#include "./thread_pool.h"
+
+typedef enum {
+    DIST_FIXED,             /* the template value */
+    DIST_SHIFT,             /* value + uniform integer in [-a, a] */
+    DIST_SCALE,             /* value * uniform real in [a, b] */
+    DIST_EXPONENTIAL        /* exponential with the value as mean */
+} DistributionKind;
+
+/* Written "fixed", "shift:3", "scale:0.5,1.5" or "exp". */
+typedef struct {
+    DistributionKind kind;
+    double a;
+    double b;
+} Distribution;
+
+/*
+ * Random workload around a template configuration. The arrival
+ * distribution applies to the gaps between consecutive arrivals, so
+ * "exp" turns the arrivals into a Poisson process with the template's
+ * mean gap; bursts and I/O durations are drawn per process (at least 1).
+ */
+typedef struct {
+    Distribution arrival;
+    Distribution burst;
+    Distribution io_duration;
+} WorkloadModel;
+
+typedef struct {
+    double mean;
+    double stddev;
+    double ci_low;          /* 95% confidence interval of the mean */
+    double ci_high;
+} MetricSummary;
+
+/*
+ * Replication r draws its workload from stream r of the seed, and every
+ * algorithm runs on that same workload. Runs are stored at fixed indices
+ * and summed in index order, so the results are bit-identical for a seed
+ * whatever the number of threads.
+ */
+typedef struct {
+    int replications;
+    int scheduler_count;
+    const Scheduler **schedulers;
+    unsigned long long seed;
+    int process_count;
+    SweepResult *runs;      /* run of scheduler s in replication r at r * scheduler_count + s */
+    MetricSummary *summary; /* scheduler s, metric m at s * SWEEP_METRIC_COUNT + m */
+    int *incomplete;        /* runs per scheduler that left processes unfinished */
+} MonteCarlo;
+
+int parse_distribution(const char *text, Distribution *dist);
+
+/* Draws a workload in place; config holds a copy of the template. */
+void workload_sample(Config *config, const WorkloadModel *model, unsigned long long *state);
+
+MonteCarlo* monte_carlo_run(ThreadPool *pool, const Config *config, const WorkloadModel *model,
+                            const Scheduler **schedulers, int scheduler_count,
+                            const SchedulerParams *params, int replications, unsigned long long seed);
+
+void monte_carlo_destroy(MonteCarlo *mc);
+
+void monte_carlo_print(FILE *out, const MonteCarlo *mc);
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "./process_state.h"
+
+#define PROCESS_STATE_TIMES 5
+#define PROCESS_STATE_FLAGS 4
+
+static size_t process_state_bytes(int n) {
+    int slots = n > 0 ? n : 1;
+    return slots * (PROCESS_STATE_TIMES * sizeof(sim_time_t) + PROCESS_STATE_FLAGS * sizeof(int));
+}
+
+ProcessState* process_state_create(Config *config) {
+    int n = config->process_count;
+    int slots = n > 0 ? n : 1;
+    ProcessState *s = malloc(sizeof(ProcessState));
+    sim_time_t *block = malloc(process_state_bytes(n));
+    if (s == NULL || block == NULL) {
+        free(s);
+        free(block);
+        return NULL;
+    }
+
+    s->count = n;
+    s->remaining = block;
+    s->executed = block + slots;
+    s->start_time = block + 2 * slots;
+    s->end_time = block + 3 * slots;
+    s->response_time = block + 4 * slots;
+
+    int *flags = (int*)(block + PROCESS_STATE_TIMES * slots);
+    s->next_io = flags;
+    s->finished = flags + slots;
+    s->started = flags + 2 * slots;
+    s->arrival_rank = flags + 3 * slots;
+
+    for (int i = 0; i < n; i++) {
+        s->remaining[i] = config->processes[i].execution_time;
+        s->executed[i] = 0;
+        s->next_io[i] = 0;
+        s->finished[i] = 0;
+        s->started[i] = 0;
+        s->arrival_rank[i] = i;
+        s->start_time[i] = -1;
+        s->end_time[i] = -1;
+        s->response_time[i] = -1;
+    }
+    return s;
+}
+
+void process_state_destroy(ProcessState *s) {
+    if (!s) return;
+    free(s->remaining);
+    free(s);
+}
+
+void process_state_checkpoint(ProcessState *s, Checkpoint *ck) {
+    ck->processes = (CheckpointProcesses){ s->count, NULL, s->remaining, s->executed, s->next_io, s->finished };
+    checkpoint_add(ck, s->remaining, process_state_bytes(s->count));
+}
+
+#ifdef __AVX2__
+/* AVX2 has no 64-bit min: keep the lanes of m where the candidate is not lower. */
+static __m256i min_epi64(__m256i m, __m256i v) {
+    return _mm256_blendv_epi8(m, v, _mm256_cmpgt_epi64(m, v));
+}
+
+static sim_time_t min_lanes(__m256i m) {
+    sim_time_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, m);
+    sim_time_t best = lanes[0];
+    for (int k = 1; k < 4; k++) best = lanes[k] < best ? lanes[k] : best;
+    return best;
+}
+#endif
+
+sim_time_t process_state_min(const sim_time_t *value, int n) {
+    sim_time_t best = LLONG_MAX;
+    int i = 0;
+#ifdef __AVX2__
+    __m256i m = _mm256_set1_epi64x(LLONG_MAX);
+    for (; i + 4 <= n; i += 4) {
+        m = min_epi64(m, _mm256_loadu_si256((const __m256i*)(value + i)));
+    }
+    best = min_lanes(m);
+#endif
+    for (; i < n; i++) {
+        best = value[i] < best ? value[i] : best;
+    }
+    return best;
+}
+
+sim_time_t process_state_min_where(const sim_time_t *value, const sim_time_t *a, sim_time_t x,
+                                   const sim_time_t *b, sim_time_t y, int n) {
+    sim_time_t best = LLONG_MAX;
+    int i = 0;
+#ifdef __AVX2__
+    const __m256i none = _mm256_set1_epi64x(LLONG_MAX);
+    const __m256i vx = _mm256_set1_epi64x(x), vy = _mm256_set1_epi64x(y);
+    __m256i m = none;
+    for (; i + 4 <= n; i += 4) {
+        __m256i match = _mm256_and_si256(
+            _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(a + i)), vx),
+            _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(b + i)), vy));
+        __m256i v = _mm256_blendv_epi8(none, _mm256_loadu_si256((const __m256i*)(value + i)), match);
+        m = min_epi64(m, v);
+    }
+    best = min_lanes(m);
+#endif
+    for (; i < n; i++) {
+        sim_time_t v = (a[i] == x && b[i] == y) ? value[i] : LLONG_MAX;
+        best = v < best ? v : best;
+    }
+    return best;
+}
+
+int process_state_count_where(const sim_time_t *a, sim_time_t x, const sim_time_t *b, sim_time_t y, int n) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        count += (a[i] == x) & (b[i] == y);
+    }
+    return count;
+}
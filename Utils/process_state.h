@@ -0,0 +1,58 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef PROCESS_STATE_H
+
+#define PROCESS_STATE_H
+
+#include "../Config/config.h"
+#include "./checkpoint.h"
+
+/*
+ * Per-run process state as a struct of arrays, one array per field,
+ * indexed by process handle and carved from a single allocation.
+ * Shortest Remaining Time keeps its processes in it; the other algorithms
+ * work on the PCB array of their configuration, which their checkpoints
+ * read, and only share the selection kernels below.
+ */
+typedef struct {
+    int count;
+    sim_time_t *remaining;
+    sim_time_t *executed;
+    sim_time_t *start_time;
+    sim_time_t *end_time;
+    sim_time_t *response_time;
+    int *next_io;
+    int *finished;
+    int *started;
+    int *arrival_rank;      /* see arrival_stream_ranks */
+} ProcessState;
+
+/* NULL if it cannot be allocated. */
+ProcessState* process_state_create(Config *config);
+
+void process_state_destroy(ProcessState *s);
+
+void process_state_checkpoint(ProcessState *s, Checkpoint *ck);
+
+/*
+ * Selection kernels over parallel arrays of n values. Every slot is read
+ * without branching, so the loops vectorize; built with -mavx2 they use
+ * AVX2 directly. A slot holding LLONG_MAX never matches a real value.
+ */
+
+/* Lowest of value[0 .. n-1], LLONG_MAX if n is 0. */
+sim_time_t process_state_min(const sim_time_t *value, int n);
+
+/* Lowest value[i] among the slots where a[i] == x and b[i] == y, LLONG_MAX if none. */
+sim_time_t process_state_min_where(const sim_time_t *value, const sim_time_t *a, sim_time_t x,
+                                   const sim_time_t *b, sim_time_t y, int n);
+
+/* Number of slots where a[i] == x and b[i] == y. */
+int process_state_count_where(const sim_time_t *a, sim_time_t x, const sim_time_t *b, sim_time_t y, int n);
+
+#endif
@@ -0,0 +1,588 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "./ready_queue.h"
+#include "./process_state.h"
+
+struct ReadyQueue {
+    ReadyQueueKind kind;
+    int capacity;
+    int size;
+
+    int *items;        /* ring buffer (FIFO), heap array (HEAP) or slots (SCAN) */
+    int head;
+
+    int *pos;          /* heap index or slot, or 1 when queued, -1 when absent */
+    long long *key;
+    long long *tie;
+    long long *seq;
+    long long next_seq;
+
+    int levels;        /* BUCKET only: one pairing heap per level */
+    int *root;
+    int *child;        /* first child */
+    int *prev;         /* previous sibling, or parent of a first child */
+    int *next;         /* next sibling */
+    int top;
+    unsigned long long *level_bits;   /* bit l set when level l is non-empty */
+    unsigned long long *word_bits;    /* bit w set when level_bits[w] != 0 */
+    int summaries;
+
+    long long *slot_key;   /* SCAN only: key, tie and seq of items[0 .. size-1] */
+    long long *slot_tie;
+    long long *slot_seq;
+    int front;             /* cached front, -1 when it has to be found again */
+};
+
+#define BITS 64
+
+
+static void* rq_alloc(size_t count, size_t size) {
+    return calloc(count > 0 ? count : 1, size);
+}
+
+ReadyQueue* ready_queue_create(ReadyQueueKind kind, int capacity, int levels) {
+    ReadyQueue *q = rq_alloc(1, sizeof(ReadyQueue));
+    if (q == NULL) return NULL;
+    q->kind = kind;
+    q->capacity = capacity;
+
+    q->items = rq_alloc(capacity, sizeof(int));
+    q->pos = rq_alloc(capacity, sizeof(int));
+    q->key = rq_alloc(capacity, sizeof(long long));
+    q->tie = rq_alloc(capacity, sizeof(long long));
+    q->seq = rq_alloc(capacity, sizeof(long long));
+    if (!q->items || !q->pos || !q->key || !q->tie || !q->seq) {
+        ready_queue_destroy(q);
+        return NULL;
+    }
+    for (int i = 0; i < capacity; i++) {
+        q->pos[i] = -1;
+    }
+    q->front = -1;
+
+    if (kind == READY_SCAN) {
+        q->levels = levels;
+        q->slot_key = rq_alloc(capacity, sizeof(long long));
+        q->slot_tie = rq_alloc(capacity, sizeof(long long));
+        q->slot_seq = rq_alloc(capacity, sizeof(long long));
+        if (!q->slot_key || !q->slot_tie || !q->slot_seq) {
+            ready_queue_destroy(q);
+            return NULL;
+        }
+    }
+
+    if (kind == READY_BUCKET) {
+        q->levels = levels > 0 ? levels : 1;
+        q->root = rq_alloc(q->levels, sizeof(int));
+        q->child = rq_alloc(capacity, sizeof(int));
+        q->prev = rq_alloc(capacity, sizeof(int));
+        q->next = rq_alloc(capacity, sizeof(int));
+        if (!q->root || !q->child || !q->prev || !q->next) {
+                ready_queue_destroy(q);
+            return NULL;
+        }
+        for (int l = 0; l < q->levels; l++) {
+            q->root[l] = -1;
+        }
+        q->top = q->levels;
+
+        int words = (q->levels + BITS - 1) / BITS;
+        q->summaries = (words + BITS - 1) / BITS;
+        q->level_bits = rq_alloc(words, sizeof(unsigned long long));
+        q->word_bits = rq_alloc(q->summaries, sizeof(unsigned long long));
+        if (!q->level_bits || !q->word_bits) {
+                ready_queue_destroy(q);
+            return NULL;
+        }
+    }
+    return q;
+}
+
+void ready_queue_destroy(ReadyQueue *q) {
+    if (!q) return;
+    free(q->items);
+    free(q->pos);
+    free(q->key);
+    free(q->tie);
+    free(q->seq);
+    free(q->root);
+    free(q->child);
+    free(q->prev);
+    free(q->next);
+    free(q->level_bits);
+    free(q->word_bits);
+    free(q->slot_key);
+    free(q->slot_tie);
+    free(q->slot_seq);
+    free(q);
+}
+
+
+static int rq_before(ReadyQueue *q, int a, int b) {
+    if (q->key[a] != q->key[b]) return q->key[a] < q->key[b];
+    if (q->tie[a] != q->tie[b]) return q->tie[a] < q->tie[b];
+    return q->seq[a] < q->seq[b];
+}
+
+static void heap_place(ReadyQueue *q, int index, int id) {
+    q->items[index] = id;
+    q->pos[id] = index;
+}
+
+static void heap_sift_up(ReadyQueue *q, int index) {
+    int id = q->items[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!rq_before(q, id, q->items[parent])) break;
+        heap_place(q, index, q->items[parent]);
+        index = parent;
+    }
+    heap_place(q, index, id);
+}
+
+static void heap_sift_down(ReadyQueue *q, int index) {
+    int id = q->items[index];
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= q->size) break;
+        if (child + 1 < q->size && rq_before(q, q->items[child + 1], q->items[child])) {
+            child++;
+        }
+        if (!rq_before(q, q->items[child], id)) break;
+        heap_place(q, index, q->items[child]);
+        index = child;
+    }
+    heap_place(q, index, id);
+}
+
+static void heap_remove_at(ReadyQueue *q, int index) {
+    int id = q->items[index];
+    q->size--;
+    q->pos[id] = -1;
+    if (index == q->size) return;
+
+    int moved = q->items[q->size];
+    heap_place(q, index, moved);
+    heap_sift_up(q, index);
+    heap_sift_down(q, q->pos[moved]);
+}
+
+
+/*
+ * Front of a SCAN queue: the lowest key, then among those the lowest tie,
+ * then the earliest insertion. The queued processes fill the first size
+ * slots, so a scan only reads the ready set; insertion numbers are never
+ * reused, so the last pass finds a single slot.
+ */
+static int scan_front(ReadyQueue *q) {
+    int n = q->size;
+    long long key = process_state_min(q->slot_key, n);
+    long long tie = process_state_min_where(q->slot_tie, q->slot_key, key, q->slot_key, key, n);
+    long long seq = process_state_min_where(q->slot_seq, q->slot_key, key, q->slot_tie, tie, n);
+
+    for (int slot = 0; slot < n; slot++) {
+        if (q->slot_seq[slot] == seq) return q->items[slot];
+    }
+    return -1;
+}
+
+static void scan_place(ReadyQueue *q, int slot, int id) {
+    q->items[slot] = id;
+    q->pos[id] = slot;
+    q->slot_key[slot] = q->key[id];
+    q->slot_tie[slot] = q->tie[id];
+    q->slot_seq[slot] = q->seq[id];
+}
+
+static long long scan_clamp(ReadyQueue *q, long long key) {
+    if (q->levels <= 0) return key;
+    if (key < 0) return 0;
+    if (key >= q->levels) return q->levels - 1;
+    return key;
+}
+
+
+static void level_mark(ReadyQueue *q, int level) {
+    int word = level / BITS;
+    q->level_bits[word] |= 1ULL << (level % BITS);
+    q->word_bits[word / BITS] |= 1ULL << (word % BITS);
+}
+
+static void level_unmark(ReadyQueue *q, int level) {
+    int word = level / BITS;
+    q->level_bits[word] &= ~(1ULL << (level % BITS));
+    if (q->level_bits[word] == 0) {
+        q->word_bits[word / BITS] &= ~(1ULL << (word % BITS));
+    }
+}
+
+/* Lowest non-empty level, found through the two bitmap layers. */
+static int level_first(ReadyQueue *q) {
+    for (int s = 0; s < q->summaries; s++) {
+        if (q->word_bits[s]) {
+            int word = s * BITS + __builtin_ctzll(q->word_bits[s]);
+            return word * BITS + __builtin_ctzll(q->level_bits[word]);
+        }
+    }
+    return q->levels;
+}
+
+/* Melds two level heaps, the later root becoming the first child of the other. */
+static int bucket_meld(ReadyQueue *q, int a, int b) {
+    if (a == -1 || (b != -1 && rq_before(q, b, a))) {
+        int t = a;
+        a = b;
+        b = t;
+    }
+    if (a == -1) return -1;
+
+    if (b != -1) {
+        q->next[b] = q->child[a];
+        if (q->child[a] != -1) q->prev[q->child[a]] = b;
+        q->prev[b] = a;
+        q->child[a] = b;
+    }
+    q->prev[a] = q->next[a] = -1;
+    return a;
+}
+
+/* Melds a list of siblings into one heap: pairs left to right, then the pairs right to left. */
+static int bucket_merge_pairs(ReadyQueue *q, int first) {
+    int pairs = -1;
+    while (first != -1) {
+        int a = first;
+        int b = q->next[a];
+        first = b != -1 ? q->next[b] : -1;
+        int m = bucket_meld(q, a, b);
+        q->prev[m] = pairs;
+        pairs = m;
+    }
+
+    int root = -1;
+    while (pairs != -1) {
+        int m = pairs;
+        pairs = q->prev[m];
+        root = bucket_meld(q, root, m);
+    }
+    return root;
+}
+
+/* Next node of a level heap in preorder, skipping the subtree of id unless descend. */
+static int bucket_walk(ReadyQueue *q, int id, int descend) {
+    if (descend && q->child[id] != -1) return q->child[id];
+    while (q->next[id] == -1) {
+        while (q->prev[id] != -1 && q->child[q->prev[id]] != id) id = q->prev[id];
+        id = q->prev[id];
+        if (id == -1) return -1;
+    }
+    return q->next[id];
+}
+
+static void bucket_link(ReadyQueue *q, int id) {
+    int level = (int)q->key[id];
+
+    q->child[id] = -1;
+    q->root[level] = bucket_meld(q, q->root[level], id);
+
+    level_mark(q, level);
+    if (level < q->top) q->top = level;
+}
+
+static void bucket_unlink(ReadyQueue *q, int id) {
+    int level = (int)q->key[id];
+
+    if (q->root[level] == id) {
+        q->root[level] = bucket_merge_pairs(q, q->child[id]);
+    } else {
+        int p = q->prev[id];
+        if (q->child[p] == id) q->child[p] = q->next[id];
+        else q->next[p] = q->next[id];
+        if (q->next[id] != -1) q->prev[q->next[id]] = p;
+
+        q->root[level] = bucket_meld(q, q->root[level], bucket_merge_pairs(q, q->child[id]));
+    }
+
+    if (q->root[level] == -1) {
+        level_unmark(q, level);
+        if (level == q->top) q->top = level_first(q);
+    }
+}
+
+
+void ready_queue_push(ReadyQueue *q, int id, long long key, long long tie) {
+    if (id < 0 || id >= q->capacity || q->pos[id] != -1) return;
+
+    q->key[id] = key;
+    q->tie[id] = tie;
+    q->seq[id] = q->next_seq++;
+
+    switch (q->kind) {
+    case READY_FIFO:
+        q->items[(q->head + q->size) % q->capacity] = id;
+        q->pos[id] = 1;
+        q->size++;
+        break;
+    case READY_HEAP:
+        q->size++;
+        heap_place(q, q->size - 1, id);
+        heap_sift_up(q, q->size - 1);
+        break;
+    case READY_BUCKET:
+        if (key < 0) q->key[id] = 0;
+        if (key >= q->levels) q->key[id] = q->levels - 1;
+        bucket_link(q, id);
+        q->pos[id] = 1;
+        q->size++;
+        break;
+    case READY_SCAN:
+        q->key[id] = scan_clamp(q, key);
+        scan_place(q, q->size, id);
+        q->size++;
+        if (q->size == 1 || (q->front != -1 && rq_before(q, id, q->front))) q->front = id;
+        break;
+    }
+}
+
+int ready_queue_peek(ReadyQueue *q) {
+    if (q->size == 0) return -1;
+
+    switch (q->kind) {
+    case READY_FIFO:
+        return q->items[q->head];
+    case READY_HEAP:
+        return q->items[0];
+    case READY_BUCKET:
+        return q->root[q->top];
+    case READY_SCAN:
+        if (q->front == -1) q->front = scan_front(q);
+        return q->front;
+    }
+    return -1;
+}
+
+int ready_queue_pop(ReadyQueue *q) {
+    int id = ready_queue_peek(q);
+    if (id != -1) {
+        ready_queue_remove(q, id);
+    }
+    return id;
+}
+
+void ready_queue_remove(ReadyQueue *q, int id) {
+    if (!ready_queue_contains(q, id)) return;
+
+    switch (q->kind) {
+    case READY_FIFO: {
+        int i = 0;
+        while (q->items[(q->head + i) % q->capacity] != id) i++;
+        for (; i > 0; i--) {
+            q->items[(q->head + i) % q->capacity] = q->items[(q->head + i - 1) % q->capacity];
+        }
+        q->head = (q->head + 1) % q->capacity;
+        q->size--;
+        q->pos[id] = -1;
+        break;
+    }
+    case READY_HEAP:
+        heap_remove_at(q, q->pos[id]);
+        break;
+    case READY_BUCKET:
+        bucket_unlink(q, id);
+        q->size--;
+        q->pos[id] = -1;
+        break;
+    case READY_SCAN: {
+        int slot = q->pos[id];
+        q->size--;
+        if (slot != q->size) scan_place(q, slot, q->items[q->size]);
+        q->pos[id] = -1;
+        if (q->front == id) q->front = -1;
+        break;
+    }
+    }
+}
+
+void ready_queue_update(ReadyQueue *q, int id, long long key) {
+    if (!ready_queue_contains(q, id) || q->key[id] == key) return;
+
+    switch (q->kind) {
+    case READY_FIFO:
+        q->key[id] = key;
+        break;
+    case READY_HEAP: {
+        int increased = key > q->key[id];
+        q->key[id] = key;
+        if (increased) heap_sift_down(q, q->pos[id]);
+        else heap_sift_up(q, q->pos[id]);
+        break;
+    }
+    case READY_BUCKET:
+        bucket_unlink(q, id);
+        if (key < 0) key = 0;
+        if (key >= q->levels) key = q->levels - 1;
+        q->key[id] = key;
+        bucket_link(q, id);
+        break;
+    case READY_SCAN: {
+        key = scan_clamp(q, key);
+        int increased = key > q->key[id];
+        q->key[id] = key;
+        q->slot_key[q->pos[id]] = key;
+        if (q->front == id) {
+            if (increased) q->front = -1;
+        } else if (q->front != -1 && rq_before(q, id, q->front)) {
+            q->front = id;
+        }
+        break;
+    }
+    }
+}
+
+int ready_queue_contains(ReadyQueue *q, int id) {
+    return id >= 0 && id < q->capacity && q->pos[id] != -1;
+}
+
+int ready_queue_size(ReadyQueue *q) {
+    return q->size;
+}
+
+long long ready_queue_key(ReadyQueue *q, int id) {
+    return ready_queue_contains(q, id) ? q->key[id] : 0;
+}
+
+/* i-th queued process: service order for FIFO, storage order otherwise. */
+int ready_queue_at(ReadyQueue *q, int i) {
+    if (i < 0 || i >= q->size) return -1;
+
+    switch (q->kind) {
+    case READY_FIFO:
+        return q->items[(q->head + i) % q->capacity];
+    case READY_HEAP:
+    case READY_SCAN:
+        return q->items[i];
+    case READY_BUCKET:
+        for (int l = q->top; l < q->levels; l++) {
+            for (int id = q->root[l]; id != -1; id = bucket_walk(q, id, 1)) {
+                if (i-- == 0) return id;
+            }
+        }
+        break;
+    }
+    return -1;
+}
+
+
+static int heap_count_ties(ReadyQueue *q, int index, int front) {
+    if (index >= q->size) return 0;
+
+    int id = q->items[index];
+    if (q->key[id] != q->key[front] || q->tie[id] != q->tie[front]) return 0;
+
+    return 1 + heap_count_ties(q, 2 * index + 1, front)
+             + heap_count_ties(q, 2 * index + 2, front);
+}
+
+/* Number of queued processes sharing the key and tie of the front one. */
+int ready_queue_ties(ReadyQueue *q) {
+    int front = ready_queue_peek(q);
+    if (front == -1) return 0;
+
+    switch (q->kind) {
+    case READY_FIFO:
+        return 1;
+    case READY_HEAP:
+        return heap_count_ties(q, 0, front);
+    case READY_BUCKET: {
+        int ties = 0;
+        /* Below a process with a later tie, every tie is later still. */
+        for (int id = front; id != -1; id = bucket_walk(q, id, q->tie[id] == q->tie[front])) {
+            if (q->tie[id] == q->tie[front]) ties++;
+        }
+        return ties;
+    }
+    case READY_SCAN:
+        return process_state_count_where(q->slot_key, q->key[front], q->slot_tie, q->tie[front], q->size);
+    }
+    return 0;
+}
+
+/* Bottom-up merge sort of queued ids in serving order. */
+static void rq_sort(ReadyQueue *q, int *ids, int *tmp, int n) {
+    for (int width = 1; width < n; width *= 2) {
+        for (int lo = 0; lo < n; lo += 2 * width) {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            int a = lo, b = mid, k = lo;
+            while (a < mid && b < hi) tmp[k++] = rq_before(q, ids[b], ids[a]) ? ids[b++] : ids[a++];
+            while (a < mid) tmp[k++] = ids[a++];
+            while (b < hi) tmp[k++] = ids[b++];
+        }
+        memcpy(ids, tmp, n * sizeof(int));
+    }
+}
+
+int ready_queue_order(ReadyQueue *q, int *ids) {
+    switch (q->kind) {
+    case READY_FIFO:
+        for (int i = 0; i < q->size; i++) {
+            ids[i] = q->items[(q->head + i) % q->capacity];
+        }
+        break;
+    case READY_HEAP:
+    case READY_BUCKET:
+    case READY_SCAN: {
+        if (q->kind != READY_BUCKET) {
+            memcpy(ids, q->items, q->size * sizeof(int));
+        } else {
+            int n = 0;
+            for (int l = q->top; l < q->levels; l++) {
+                for (int id = q->root[l]; id != -1; id = bucket_walk(q, id, 1)) ids[n++] = id;
+            }
+        }
+        int *tmp = rq_alloc(q->size, sizeof(int));
+        if (tmp == NULL) return -1;
+        rq_sort(q, ids, tmp, q->size);
+        free(tmp);
+        break;
+    }
+    }
+    return q->size;
+}
+
+void ready_queue_checkpoint(ReadyQueue *q, Checkpoint *ck) {
+    checkpoint_add(ck, &q->size, sizeof(q->size));
+    checkpoint_add(ck, &q->head, sizeof(q->head));
+    checkpoint_add(ck, &q->next_seq, sizeof(q->next_seq));
+    checkpoint_add(ck, q->items, q->capacity * sizeof(int));
+    checkpoint_add(ck, q->pos, q->capacity * sizeof(int));
+    checkpoint_add(ck, q->key, q->capacity * sizeof(long long));
+    checkpoint_add(ck, q->tie, q->capacity * sizeof(long long));
+    checkpoint_add(ck, q->seq, q->capacity * sizeof(long long));
+
+    if (q->kind == READY_SCAN) {
+        checkpoint_add(ck, &q->front, sizeof(q->front));
+        checkpoint_add(ck, q->slot_key, q->capacity * sizeof(long long));
+        checkpoint_add(ck, q->slot_tie, q->capacity * sizeof(long long));
+        checkpoint_add(ck, q->slot_seq, q->capacity * sizeof(long long));
+    }
+
+    if (q->kind == READY_BUCKET) {
+        int words = (q->levels + BITS - 1) / BITS;
+        checkpoint_add(ck, &q->top, sizeof(q->top));
+        checkpoint_add(ck, q->root, q->levels * sizeof(int));
+        checkpoint_add(ck, q->child, q->capacity * sizeof(int));
+        checkpoint_add(ck, q->prev, q->capacity * sizeof(int));
+        checkpoint_add(ck, q->next, q->capacity * sizeof(int));
+        checkpoint_add(ck, q->level_bits, words * sizeof(unsigned long long));
+        checkpoint_add(ck, q->word_bits, q->summaries * sizeof(unsigned long long));
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef READY_QUEUE_H
+
+#define READY_QUEUE_H
+
+#include "./checkpoint.h"
+
+/*
+ * Ready queue holding process indices (0 .. capacity-1), each at most once.
+ *
+ * READY_FIFO   ring buffer, served in insertion order, keys ignored
+ * READY_HEAP   binary heap ordered by (key, tie, insertion order)
+ * READY_BUCKET one pairing heap per key in [0, levels), each ordered by
+ *              (tie, insertion order); the lowest key is served first,
+ *              the lowest non-empty level being found through a bitmap
+ * READY_SCAN   same order as READY_HEAP, keys clamped to [0, levels) when
+ *              levels > 0 as in READY_BUCKET; the front is found by
+ *              scanning the key, tie and insertion arrays with the
+ *              process_state selection kernels, and cached until it
+ *              leaves the queue
+ *
+ * Each algorithm picks the backend matching its selection rule.
+ */
+typedef enum {
+    READY_FIFO,
+    READY_HEAP,
+    READY_BUCKET,
+    READY_SCAN
+} ReadyQueueKind;
+
+typedef struct ReadyQueue ReadyQueue;
+
+/* NULL if the memory cannot be allocated. */
+ReadyQueue* ready_queue_create(ReadyQueueKind kind, int capacity, int levels);
+
+void ready_queue_destroy(ReadyQueue *q);
+
+void ready_queue_push(ReadyQueue *q, int id, long long key, long long tie);
+
+int ready_queue_peek(ReadyQueue *q);
+
+int ready_queue_pop(ReadyQueue *q);
+
+void ready_queue_remove(ReadyQueue *q, int id);
+
+void ready_queue_update(ReadyQueue *q, int id, long long key);
+
+int ready_queue_contains(ReadyQueue *q, int id);
+
+int ready_queue_size(ReadyQueue *q);
+
+long long ready_queue_key(ReadyQueue *q, int id);
+
+int ready_queue_at(ReadyQueue *q, int i);
+
+int ready_queue_ties(ReadyQueue *q);
+
+/* Writes the queued ids in the order they would be served; returns their number, or -1 out of memory. */
+int ready_queue_order(ReadyQueue *q, int *ids);
+
+/* Registers the contents of the queue with a checkpoint. */
+void ready_queue_checkpoint(ReadyQueue *q, Checkpoint *ck);
+
+#endif
@@ -0,0 +1,506 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "result_cache.h"
+
+
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+/* Changes whenever the simulation or the file layout would give other results. */
+#define RUN_MAGIC "SCHDRUN1"
+
+struct CachedRun {
+    unsigned long long key;
+    int slice_count;
+    int io_slice_count;
+    int dropped;
+    SliceRecord *slices;    /* CPU slices, then I/O slices */
+
+    int tracked;
+    sim_time_t *usage;      /* first_run, completion and executed, tracked each */
+    sim_time_t busy;
+
+    int has_log;
+    char *log;              /* log body, after the header */
+    size_t log_size;
+
+    size_t bytes;
+    CachedRun *prev;
+    CachedRun *next;
+};
+
+struct ResultCache {
+    char dir[512];
+    size_t memory_limit;
+    size_t disk_limit;
+    size_t memory_used;
+    CachedRun *head;        /* most recently used */
+    CachedRun *tail;
+};
+
+typedef struct {
+    char magic[8];
+    unsigned long long key;
+    int slice_count;
+    int io_slice_count;
+    int dropped;
+    int tracked;
+    sim_time_t busy;
+    int has_log;
+    unsigned long long log_size;
+} RunFileHeader;
+
+
+static unsigned long long hash_bytes(unsigned long long h, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= bytes[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+
+static unsigned long long hash_value(unsigned long long h, long long value) {
+    unsigned char bytes[8];
+    for (int i = 0; i < 8; i++) bytes[i] = (unsigned char)((unsigned long long)value >> (8 * i));
+    return hash_bytes(h, bytes, sizeof(bytes));
+}
+
+
+static unsigned long long hash_text(unsigned long long h, const char *text, size_t max) {
+    size_t len = strnlen(text, max);
+    h = hash_value(h, (long long)len);
+    return hash_bytes(h, text, len);
+}
+
+
+/*
+ * Only what the run depends on is hashed: comments, layout and key order
+ * of the file, the I/O pool layout and the parameters the algorithm
+ * ignores leave the key unchanged.
+ */
+unsigned long long result_cache_key(const Config *config, const Scheduler *scheduler,
+                                    const SchedulerParams *params) {
+    unsigned long long h = FNV_OFFSET;
+
+    h = hash_text(h, RUN_MAGIC, sizeof(RUN_MAGIC));
+    h = hash_text(h, scheduler->name, 64);
+    h = hash_value(h, scheduler->needs_quantum ? params->quantum : 0);
+    h = hash_value(h, scheduler->needs_aging ? params->aging_interval : 0);
+    h = hash_value(h, scheduler->needs_aging ? params->max_priority : 0);
+    h = hash_text(h, config->time_unit, sizeof(config->time_unit));
+
+    h = hash_value(h, config->process_count);
+    for (int i = 0; i < config->process_count; i++) {
+        const PROCESS *p = &config->processes[i];
+        h = hash_text(h, p->ID, strlen(p->ID) + 1);
+        h = hash_value(h, p->arrival_time);
+        h = hash_value(h, p->execution_time);
+        h = hash_value(h, p->priority);
+        h = hash_value(h, p->io_count);
+        const IO_OPERATION *ios = config->io_pool + p->io_start;
+        for (int j = 0; j < p->io_count; j++) {
+            h = hash_value(h, ios[j].start_time);
+            h = hash_value(h, ios[j].duration);
+        }
+    }
+    return h;
+}
+
+
+static void make_dirs(const char *path) {
+    char dir[512];
+    snprintf(dir, sizeof(dir), "%s", path);
+    for (char *p = dir + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        #ifdef _WIN32
+            mkdir(dir);
+        #else
+            mkdir(dir, 0755);
+        #endif
+        *p = '/';
+    }
+    #ifdef _WIN32
+        mkdir(dir);
+    #else
+        mkdir(dir, 0755);
+    #endif
+}
+
+
+ResultCache* result_cache_create(const char *dir, size_t memory_limit, size_t disk_limit) {
+    ResultCache *cache = calloc(1, sizeof(ResultCache));
+    if (!cache) return NULL;
+
+    if (dir && dir[0]) {
+        snprintf(cache->dir, sizeof(cache->dir), "%s", dir);
+        make_dirs(cache->dir);
+    }
+    cache->memory_limit = memory_limit;
+    cache->disk_limit = disk_limit;
+    return cache;
+}
+
+
+static void run_free(CachedRun *run) {
+    if (!run) return;
+    free(run->slices);
+    free(run->usage);
+    free(run->log);
+    free(run);
+}
+
+
+void result_cache_destroy(ResultCache *cache) {
+    if (!cache) return;
+    CachedRun *run = cache->head;
+    while (run) {
+        CachedRun *next = run->next;
+        run_free(run);
+        run = next;
+    }
+    free(cache);
+}
+
+
+static void cache_unlink(ResultCache *cache, CachedRun *run) {
+    if (run->prev) run->prev->next = run->next;
+    else cache->head = run->next;
+    if (run->next) run->next->prev = run->prev;
+    else cache->tail = run->prev;
+    run->prev = run->next = NULL;
+}
+
+
+static void cache_push_front(ResultCache *cache, CachedRun *run) {
+    run->prev = NULL;
+    run->next = cache->head;
+    if (cache->head) cache->head->prev = run;
+    cache->head = run;
+    if (!cache->tail) cache->tail = run;
+}
+
+
+static CachedRun* cache_find(ResultCache *cache, unsigned long long key) {
+    for (CachedRun *run = cache->head; run; run = run->next) {
+        if (run->key == key) return run;
+    }
+    return NULL;
+}
+
+
+static void cache_insert(ResultCache *cache, CachedRun *run) {
+    CachedRun *old = cache_find(cache, run->key);
+    if (old) {
+        cache_unlink(cache, old);
+        cache->memory_used -= old->bytes;
+        run_free(old);
+    }
+    cache_push_front(cache, run);
+    cache->memory_used += run->bytes;
+
+    while (cache->memory_used > cache->memory_limit && cache->tail != run) {
+        CachedRun *last = cache->tail;
+        cache_unlink(cache, last);
+        cache->memory_used -= last->bytes;
+        run_free(last);
+    }
+}
+
+
+static void run_path(const ResultCache *cache, unsigned long long key, char *path, size_t size) {
+    snprintf(path, size, "%s/%016llx.run", cache->dir, key);
+}
+
+
+static int run_write(const CachedRun *run, const char *path) {
+    char tmp[640];
+    snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", path, (long)getpid());
+    FILE *file = fopen(tmp, "wb");
+    if (!file) return -1;
+
+    RunFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RUN_MAGIC, sizeof(header.magic));
+    header.key = run->key;
+    header.slice_count = run->slice_count;
+    header.io_slice_count = run->io_slice_count;
+    header.dropped = run->dropped;
+    header.tracked = run->tracked;
+    header.busy = run->busy;
+    header.has_log = run->has_log;
+    header.log_size = run->log_size;
+    size_t slices = (size_t)run->slice_count + run->io_slice_count;
+    size_t usage = 3 * (size_t)run->tracked;
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             (slices == 0 || fwrite(run->slices, sizeof(SliceRecord), slices, file) == slices) &&
+             (usage == 0 || fwrite(run->usage, sizeof(sim_time_t), usage, file) == usage) &&
+             (run->log_size == 0 || fwrite(run->log, 1, run->log_size, file) == run->log_size);
+    if (fclose(file) != 0) ok = 0;
+
+    /* Renamed once complete, so a reader never sees half a file. */
+    if (!ok || rename(tmp, path) != 0) {
+        remove(tmp);
+        return -1;
+    }
+    return 0;
+}
+
+
+static CachedRun* run_read(const char *path, unsigned long long key) {
+    FILE *file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    RunFileHeader header;
+    CachedRun *run = NULL;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, RUN_MAGIC, sizeof(header.magic)) != 0 || header.key != key ||
+        header.slice_count < 0 || header.io_slice_count < 0 ||
+        header.tracked < 0 || header.log_size > ((size_t)1 << 30)) goto fail;
+
+    run = calloc(1, sizeof(CachedRun));
+    if (!run) goto fail;
+    run->key = key;
+    run->slice_count = header.slice_count;
+    run->io_slice_count = header.io_slice_count;
+    run->dropped = header.dropped;
+    run->tracked = header.tracked;
+    run->busy = header.busy;
+    run->has_log = header.has_log;
+    run->log_size = header.log_size;
+
+    size_t slices = (size_t)run->slice_count + run->io_slice_count;
+    size_t usage = 3 * (size_t)run->tracked;
+    if (slices > 0 && !(run->slices = malloc(slices * sizeof(SliceRecord)))) goto fail;
+    if (usage > 0 && !(run->usage = malloc(usage * sizeof(sim_time_t)))) goto fail;
+    if (run->log_size > 0 && !(run->log = malloc(run->log_size))) goto fail;
+
+    if ((slices > 0 && fread(run->slices, sizeof(SliceRecord), slices, file) != slices) ||
+        (usage > 0 && fread(run->usage, sizeof(sim_time_t), usage, file) != usage) ||
+        (run->log_size > 0 && fread(run->log, 1, run->log_size, file) != run->log_size)) goto fail;
+    fclose(file);
+
+    run->bytes = sizeof(CachedRun) + slices * sizeof(SliceRecord) + usage * sizeof(sim_time_t) + run->log_size;
+    return run;
+
+fail:
+    fclose(file);
+    run_free(run);
+    return NULL;
+}
+
+
+typedef struct {
+    char name[64];
+    off_t size;
+    time_t used;
+} CacheFile;
+
+
+static int compare_used(const void *a, const void *b) {
+    time_t x = ((const CacheFile *)a)->used;
+    time_t y = ((const CacheFile *)b)->used;
+    return (x > y) - (x < y);
+}
+
+
+/* Removes the least recently used files past disk_limit, keeping `keep`. */
+static void cache_trim_disk(ResultCache *cache, const char *keep) {
+    DIR *dir = opendir(cache->dir);
+    if (!dir) return;
+
+    CacheFile *files = NULL;
+    int count = 0, capacity = 0;
+    off_t total = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t len = strlen(entry->d_name);
+        if (len < 5 || len >= sizeof(files->name) || strcmp(entry->d_name + len - 4, ".run") != 0) continue;
+
+        char path[1024];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", cache->dir, entry->d_name);
+        if (stat(path, &st) != 0) continue;
+
+        if (count == capacity) {
+            int grown = capacity ? capacity * 2 : 64;
+            CacheFile *more = realloc(files, grown * sizeof(CacheFile));
+            if (!more) break;
+            files = more;
+            capacity = grown;
+        }
+        memcpy(files[count].name, entry->d_name, len + 1);
+        files[count].size = st.st_size;
+        files[count].used = st.st_mtime;
+        total += st.st_size;
+        count++;
+    }
+    closedir(dir);
+
+    qsort(files, count, sizeof(CacheFile), compare_used);
+    for (int i = 0; i < count && (size_t)total > cache->disk_limit; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s", cache->dir, files[i].name);
+        if (strcmp(path, keep) == 0) continue;
+        if (remove(path) == 0) total -= files[i].size;
+    }
+    free(files);
+}
+
+
+static int log_capture(CachedRun *run, const LogSink *log) {
+    if (log->file) fflush(log->file);
+    FILE *file = fopen(log->path, "rb");
+    if (!file) return 0;
+
+    int ok = 0;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long end = ftell(file);
+        long size = end > log->body_start ? end - log->body_start : 0;
+        run->log = size > 0 ? malloc(size) : NULL;
+        if (size == 0 || (run->log && fseek(file, log->body_start, SEEK_SET) == 0 &&
+                          fread(run->log, 1, size, file) == (size_t)size)) {
+            run->log_size = size;
+            ok = 1;
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+
+static CachedRun* run_capture(unsigned long long key, const SimContext *ctx) {
+    const Timeline *t = &ctx->timeline;
+    CachedRun *run = calloc(1, sizeof(CachedRun));
+    if (!run) return NULL;
+
+    run->key = key;
+    run->slice_count = t->slice_count;
+    run->io_slice_count = t->io_slice_count;
+    run->dropped = t->dropped;
+    size_t slices = (size_t)t->slice_count + t->io_slice_count;
+    if (slices > 0 && !(run->slices = malloc(slices * sizeof(SliceRecord)))) goto fail;
+    if (slices > 0) timeline_export(t, run->slices);
+
+    run->tracked = ctx->tracked;
+    run->busy = ctx->busy;
+    if (ctx->tracked > 0) {
+        size_t n = ctx->tracked;
+        if (!(run->usage = malloc(3 * n * sizeof(sim_time_t)))) goto fail;
+        memcpy(run->usage, ctx->first_run, n * sizeof(sim_time_t));
+        memcpy(run->usage + n, ctx->completion, n * sizeof(sim_time_t));
+        memcpy(run->usage + 2 * n, ctx->executed, n * sizeof(sim_time_t));
+    }
+
+    if (ctx->log.path[0]) {
+        if (!log_capture(run, &ctx->log)) goto fail;
+        run->has_log = 1;
+    }
+
+    run->bytes = sizeof(CachedRun) + slices * sizeof(SliceRecord)
+               + 3 * (size_t)run->tracked * sizeof(sim_time_t) + run->log_size;
+    return run;
+
+fail:
+    run_free(run);
+    return NULL;
+}
+
+
+static int run_covers(const CachedRun *run, const SimContext *ctx) {
+    if (ctx->tracked > 0 && run->tracked != ctx->tracked) return 0;
+    if (ctx->log.path[0] && !run->has_log) return 0;
+    return 1;
+}
+
+
+const CachedRun* result_cache_lookup(ResultCache *cache, unsigned long long key, const SimContext *ctx) {
+    char path[600] = "";
+    if (cache->dir[0]) run_path(cache, key, path, sizeof(path));
+
+    CachedRun *run = cache_find(cache, key);
+    if (!run && path[0] && (run = run_read(path, key)) != NULL) {
+        cache_insert(cache, run);
+    }
+    if (!run || !run_covers(run, ctx)) return NULL;
+
+    if (run != cache->head) {
+        cache_unlink(cache, run);
+        cache_push_front(cache, run);
+    }
+    if (path[0]) utime(path, NULL);
+    return run;
+}
+
+
+int result_cache_restore(const CachedRun *run, SimContext *ctx) {
+    if (!timeline_import(&ctx->timeline, run->slices, run->slice_count, run->io_slice_count, run->dropped)) return -1;
+
+    if (ctx->tracked > 0 && run->tracked == ctx->tracked) {
+        size_t n = ctx->tracked;
+        memcpy(ctx->first_run, run->usage, n * sizeof(sim_time_t));
+        memcpy(ctx->completion, run->usage + n, n * sizeof(sim_time_t));
+        memcpy(ctx->executed, run->usage + 2 * n, n * sizeof(sim_time_t));
+    }
+    ctx->busy = run->busy;
+
+    if (run->has_log && ctx->log.path[0]) {
+        if (!ctx->log.file) ctx->log.file = fopen(ctx->log.path, "a");
+        if (ctx->log.file && run->log_size > 0) {
+            fwrite(run->log, 1, run->log_size, ctx->log.file);
+            fflush(ctx->log.file);
+        }
+    }
+    return 0;
+}
+
+
+int result_cache_store(ResultCache *cache, unsigned long long key, const SimContext *ctx) {
+    CachedRun *run = run_capture(key, ctx);
+    if (!run) return -1;
+
+    if (cache->dir[0]) {
+        char path[600];
+        run_path(cache, key, path, sizeof(path));
+        if (run_write(run, path) == 0) cache_trim_disk(cache, path);
+    }
+    cache_insert(cache, run);
+    return 0;
+}
+
+
+int result_cache_run(ResultCache *cache, SimContext *ctx, const char *algorithm, const SchedulerParams *params) {
+    const Scheduler *scheduler = find_scheduler(algorithm);
+    if (!scheduler) return -1;
+
+    unsigned long long key = result_cache_key(&ctx->config, scheduler, params);
+    const CachedRun *run = result_cache_lookup(cache, key, ctx);
+    if (run) {
+        result_cache_restore(run, ctx);
+        /* The cached body already ends the way sim_run closes the log. */
+        if (ctx->log.file) {
+            fclose(ctx->log.file);
+            ctx->log.file = NULL;
+        }
+        return 1;
+    }
+
+    if (sim_run(ctx, algorithm, params) != 0) return -2;
+    result_cache_store(cache, key, ctx);
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef RESULT_CACHE_H
+
+#define RESULT_CACHE_H
+
+#include <stddef.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sim_context.h"
+
+#define RESULT_CACHE_DIR "output/cache"
+#define RESULT_CACHE_MEMORY_LIMIT (64u << 20)
+#define RESULT_CACHE_DISK_LIMIT (256u << 20)
+
+/*
+ * Finished runs addressed by a hash of what determines them: the
+ * processes and I/O operations of the configuration, the algorithm and
+ * the parameters it uses. A run holds its CPU and I/O slices, the CPU
+ * usage of each process (from which the metrics are computed) and the
+ * body of its log.
+ *
+ * Recent runs stay in memory, the least recently used going first past
+ * memory_limit bytes. With a directory, every run is also written there
+ * as <key>.run, and the least recently used files are removed past
+ * disk_limit bytes, so runs survive a restart. A cache is used from one
+ * thread at a time.
+ */
+typedef struct ResultCache ResultCache;
+typedef struct CachedRun CachedRun;
+
+unsigned long long result_cache_key(const Config *config, const Scheduler *scheduler,
+                                    const SchedulerParams *params);
+
+/* An empty or NULL dir keeps the runs in memory only. */
+ResultCache* result_cache_create(const char *dir, size_t memory_limit, size_t disk_limit);
+
+void result_cache_destroy(ResultCache *cache);
+
+/*
+ * The cached run of key, if it holds everything ctx records (usage, log).
+ * It stays valid until the next call on the cache.
+ */
+const CachedRun* result_cache_lookup(ResultCache *cache, unsigned long long key, const SimContext *ctx);
+
+/* Puts a cached run back into ctx: timeline, CPU usage and log body; -1 if the timeline does not fit in memory. */
+int result_cache_restore(const CachedRun *run, SimContext *ctx);
+
+/* Records the run that just ended on ctx. */
+int result_cache_store(ResultCache *cache, unsigned long long key, const SimContext *ctx);
+
+/*
+ * sim_run through the cache: 1 if the run was cached, 0 if it was simulated,
+ * -1 if the name is unknown, -2 if it failed, which is then not stored.
+ */
+int result_cache_run(ResultCache *cache, SimContext *ctx, const char *algorithm, const SchedulerParams *params);
+
+#endif
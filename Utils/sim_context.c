@@ -0,0 +1,229 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "sim_context.h"
+#include "checkpoint.h"
+#include "result_cache.h"
+#include "snapshot.h"
+
+
+static SimContext default_context;
+static _Thread_local SimContext *current_context = NULL;
+
+
+SimContext* sim_current(void) {
+    if (current_context) return current_context;
+    if (!default_context.console) default_context.console = stdout;
+    return &default_context;
+}
+
+
+SimContext* sim_context_create(const Config *config) {
+    SimContext *ctx = calloc(1, sizeof(SimContext));
+    if (ctx == NULL) {
+        fprintf(stderr, "Memory allocation failed for simulation context\n");
+        return NULL;
+    }
+    if (config && !config_copy(&ctx->config, config)) {
+        sim_context_destroy(ctx);
+        return NULL;
+    }
+
+    int count = ctx->config.process_count;
+    if (count > 0) {
+        ctx->first_run = malloc(3 * count * sizeof(sim_time_t));
+        if (ctx->first_run == NULL) {
+            fprintf(stderr, "Memory allocation failed for simulation context\n");
+            sim_context_destroy(ctx);
+            return NULL;
+        }
+        ctx->completion = ctx->first_run + count;
+        ctx->executed = ctx->completion + count;
+        ctx->tracked = count;
+    }
+    ctx->console = stdout;
+    return ctx;
+}
+
+
+void sim_context_destroy(SimContext *ctx) {
+    if (!ctx) return;
+    log_sink_close(&ctx->log);
+    config_release(&ctx->config);
+    timeline_release(&ctx->timeline);
+    free(ctx->first_run);
+    free(ctx);
+}
+
+
+void sim_context_set_console(SimContext *ctx, FILE *console) {
+    ctx->console = console;
+}
+
+
+int sim_context_set_checkpoint(SimContext *ctx, const char *path, double interval,
+                               const Scheduler *scheduler, const SchedulerParams *params) {
+    SimCheckpoint *ck = &ctx->checkpoint;
+    snprintf(ck->path, sizeof(ck->path), "%s", path);
+    ck->interval = interval;
+    ck->key = result_cache_key(&ctx->config, scheduler, params);
+    ck->log_offset = 0;
+    ck->resume = checkpoint_probe(ck->path, ck->key, &ck->log_offset);
+    return ck->resume;
+}
+
+
+int sim_context_open_log(SimContext *ctx, const char *algo_name, const char *config_file) {
+    SimCheckpoint *ck = &ctx->checkpoint;
+    if (ck->resume) {
+        if (ck->log_offset > 0 && log_sink_reopen(&ctx->log, algo_name, config_file, ck->log_offset) == 0) return 0;
+        /* The log the checkpoint goes with is gone: start over. */
+        ck->resume = 0;
+    }
+    return log_sink_open(&ctx->log, algo_name, config_file);
+}
+
+
+int sim_run(SimContext *ctx, const char *algorithm, const SchedulerParams *params) {
+    const Scheduler *scheduler = find_scheduler(algorithm);
+    if (!scheduler) return -1;
+
+    for (int i = 0; i < ctx->tracked; i++) {
+        ctx->first_run[i] = -1;
+        ctx->completion[i] = 0;
+        ctx->executed[i] = 0;
+    }
+    ctx->busy = 0;
+    ctx->failed = 0;
+    ctx->error[0] = '\0';
+    if (ctx->snapshots) snapshot_index_start(ctx->snapshots, scheduler, params);
+
+    SimContext *previous = current_context;
+    current_context = ctx;
+    scheduler->run(&ctx->config, params);
+    log_sink_close(&ctx->log);
+    current_context = previous;
+    memset(&ctx->checkpoint, 0, sizeof(ctx->checkpoint));
+    return ctx->failed ? -2 : 0;
+}
+
+
+void sim_fail(const char *format, ...) {
+    SimContext *ctx = sim_current();
+    char reason[sizeof(ctx->error)];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(reason, sizeof(reason), format, args);
+    va_end(args);
+
+    if (!ctx->failed) memcpy(ctx->error, reason, sizeof(reason));
+    ctx->failed = 1;
+    sim_printf("%s\n", reason);
+    log_print("%s\n", reason);
+}
+
+
+static int compare_time(const void *a, const void *b) {
+    sim_time_t x = *(const sim_time_t *)a;
+    sim_time_t y = *(const sim_time_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+void sim_context_metrics(const SimContext *ctx, SimMetrics *metrics) {
+    double turnaround = 0, waiting = 0, response = 0;
+    sim_time_t *waits = ctx->tracked > 0 ? malloc(ctx->tracked * sizeof(sim_time_t)) : NULL;
+
+    metrics->finished = 0;
+    metrics->makespan = 0;
+    metrics->max_waiting = 0;
+    metrics->p95_waiting = 0;
+    metrics->busy = ctx->busy;
+    for (int i = 0; i < ctx->tracked; i++) {
+        const PROCESS *p = &ctx->config.processes[i];
+        if (ctx->first_run[i] < 0 || ctx->executed[i] < p->execution_time) continue;
+
+        sim_time_t t = ctx->completion[i] - p->arrival_time;
+        sim_time_t wait = t - p->execution_time;
+        turnaround += t;
+        waiting += wait;
+        if (wait > metrics->max_waiting) metrics->max_waiting = wait;
+        if (waits) waits[metrics->finished] = wait;
+        response += ctx->first_run[i] - p->arrival_time;
+        if (ctx->completion[i] > metrics->makespan) metrics->makespan = ctx->completion[i];
+        metrics->finished++;
+    }
+
+    if (waits && metrics->finished > 0) {
+        qsort(waits, metrics->finished, sizeof(sim_time_t), compare_time);
+        int rank = (95 * metrics->finished + 99) / 100;
+        metrics->p95_waiting = waits[rank - 1];
+    }
+    free(waits);
+
+    metrics->avg_turnaround = metrics->finished ? turnaround / metrics->finished : 0;
+    metrics->avg_waiting = metrics->finished ? waiting / metrics->finished : 0;
+    metrics->avg_response = metrics->finished ? response / metrics->finished : 0;
+}
+
+
+int sim_tracing(void) {
+    SimContext *ctx = sim_current();
+    return ctx->console != NULL || ctx->log.path[0] != '\0';
+}
+
+
+int sim_printf(const char *format, ...) {
+    FILE *console = sim_current()->console;
+    if (!console) return 0;
+
+    va_list args;
+    va_start(args, format);
+    int written = vfprintf(console, format, args);
+    va_end(args);
+    return written;
+}
+
+
+void add_gantt_slice(int process, sim_time_t start, sim_time_t duration, const char* color) {
+    SimContext *ctx = sim_current();
+    /* A replay is only after the state of the scheduler. */
+    if (ctx->seek) return;
+    if (process >= 0 && process < ctx->tracked) {
+        if (ctx->first_run[process] < 0) ctx->first_run[process] = start;
+        if (start + duration > ctx->completion[process]) ctx->completion[process] = start + duration;
+        ctx->executed[process] += duration;
+        ctx->busy += duration;
+    }
+    /* Failed once per run: the slices that follow are dropped as well. */
+    if (!timeline_add_slice(&ctx->timeline, process, start, duration, color) && ctx->timeline.dropped == 1) {
+        sim_fail("Memory allocation failed for %d Gantt slices", ctx->timeline.slice_count + 1);
+    }
+}
+
+
+void add_io_slice(int process, sim_time_t start, sim_time_t duration, const char* color, const char* io_type) {
+    SimContext *ctx = sim_current();
+    if (ctx->seek) return;
+    if (!timeline_add_io_slice(&ctx->timeline, process, start, duration, color, io_type) && ctx->timeline.dropped == 1) {
+        sim_fail("Memory allocation failed for %d I/O slices", ctx->timeline.io_slice_count + 1);
+    }
+}
+
+
+void clear_gantt_slices(void) {
+    timeline_clear_slices(&sim_current()->timeline);
+}
+
+
+void clear_io_slices(void) {
+    timeline_clear_io_slices(&sim_current()->timeline);
+}
@@ -0,0 +1,121 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef SIM_CONTEXT_H
+
+#define SIM_CONTEXT_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./log_file.h"
+#include "./timeline.h"
+
+/*
+ * Everything a simulation run writes: its own copy of the configuration
+ * (the algorithms reset its PCBs), the Gantt timeline, the log file and
+ * the console the progress trace is printed to.
+ *
+ * The algorithms work on the context current in their thread. sim_run
+ * makes a context current for the duration of a run, so any number of
+ * contexts can run side by side; outside of sim_run a default context
+ * printing to stdout is current.
+ */
+/* Where and how often the next run of a context is checkpointed (Utils/checkpoint.h). */
+typedef struct {
+    char path[512];         /* empty: no checkpoints */
+    double interval;        /* seconds between two checkpoints */
+    unsigned long long key; /* run the checkpoints belong to */
+    int resume;             /* path holds a checkpoint of that run */
+    long log_offset;        /* length of the log when it was taken */
+} SimCheckpoint;
+
+/* Snapshots of a run and a replay looking for the state at some time (Utils/snapshot.h). */
+typedef struct SnapshotIndex SnapshotIndex;
+typedef struct SnapshotSeek SnapshotSeek;
+
+typedef struct {
+    Config config;
+    Timeline timeline;
+    LogSink log;
+    FILE *console;          /* NULL discards the trace */
+
+    /* Per-process CPU usage of the last run, taken from every slice. */
+    int tracked;
+    sim_time_t *first_run;  /* -1 until the process first runs */
+    sim_time_t *completion; /* end of its last CPU slice */
+    sim_time_t *executed;
+    sim_time_t busy;
+
+    SimCheckpoint checkpoint;
+    SnapshotIndex *snapshots;   /* NULL: none are taken */
+    SnapshotSeek *seek;
+
+    int failed;             /* the last run gave up, see sim_fail */
+    char error[256];        /* why it did */
+} SimContext;
+
+typedef struct {
+    int finished;           /* processes that received their whole burst */
+    sim_time_t makespan;
+    sim_time_t busy;        /* ticks the CPU executed a process */
+    double avg_turnaround;
+    double avg_waiting;
+    double avg_response;
+    sim_time_t max_waiting;
+    sim_time_t p95_waiting; /* nearest rank over the finished processes */
+} SimMetrics;
+
+SimContext* sim_context_create(const Config *config);
+
+void sim_context_destroy(SimContext *ctx);
+
+void sim_context_set_console(SimContext *ctx, FILE *console);
+
+/*
+ * Checkpoints the next run, of scheduler with params, to path every
+ * interval seconds; the file is removed once the run completes. Returns 1
+ * when path already holds a checkpoint of that same run: the run then
+ * resumes from it, and the log opened next carries on where it stopped.
+ */
+int sim_context_set_checkpoint(SimContext *ctx, const char *path, double interval,
+                               const Scheduler *scheduler, const SchedulerParams *params);
+
+int sim_context_open_log(SimContext *ctx, const char *algo_name, const char *config_file);
+
+/*
+ * Runs the named scheduler on the context. Returns 0, -1 if the name is
+ * unknown, or -2 if the run gave up before completing; its metrics are
+ * then meaningless.
+ */
+int sim_run(SimContext *ctx, const char *algorithm, const SchedulerParams *params);
+
+/*
+ * Called by an algorithm when it cannot go on: out of memory, or a
+ * checkpoint it cannot restore. It then returns at once. The reason is
+ * printed to the trace and the log of the current context and kept in
+ * its error, the first one if several are given.
+ */
+void sim_fail(const char *format, ...);
+
+void sim_context_metrics(const SimContext *ctx, SimMetrics *metrics);
+
+SimContext* sim_current(void);
+
+/* Trace and timeline of the current context, used by the algorithms. */
+int sim_printf(const char *format, ...);
+
+/* Whether the trace goes anywhere; quiet ticks are only walked one by one when it does. */
+int sim_tracing(void);
+
+void add_gantt_slice(int process, sim_time_t start, sim_time_t duration, const char* color);
+void clear_gantt_slices(void);
+
+void add_io_slice(int process, sim_time_t start, sim_time_t duration, const char* color, const char* io_type);
+void clear_io_slices(void);
+
+#endif
@@ -0,0 +1,320 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "snapshot.h"
+#include "engine.h"
+#include "ready_queue.h"
+
+
+typedef struct {
+    sim_time_t time;
+    unsigned long long layout;
+    size_t size;
+    unsigned char *data;
+} Snapshot;
+
+struct SnapshotIndex {
+    sim_time_t first_interval;
+    sim_time_t interval;
+    sim_time_t next;            /* clock of the next snapshot */
+    const Scheduler *scheduler;
+    SchedulerParams params;
+    int count;
+    Snapshot items[SNAPSHOT_MAX];   /* by increasing time */
+};
+
+/* A replay stopping at the first step of its loop at `time`. */
+struct SnapshotSeek {
+    const SnapshotIndex *index;
+    sim_time_t time;
+    SimState *state;
+    int captured;
+    int failed;                 /* the state could not be allocated */
+    int overshot;               /* a step went from before time to after it */
+    sim_time_t last;            /* clock of the last step before time */
+};
+
+
+SnapshotIndex* snapshot_index_create(sim_time_t interval) {
+    SnapshotIndex *index = calloc(1, sizeof(SnapshotIndex));
+    if (index == NULL) {
+        fprintf(stderr, "Memory allocation failed for snapshot index\n");
+        return NULL;
+    }
+    index->first_interval = interval > 0 ? interval : SNAPSHOT_INTERVAL;
+    index->interval = index->first_interval;
+    index->next = index->interval;
+    return index;
+}
+
+
+static void snapshot_index_clear(SnapshotIndex *index) {
+    for (int i = 0; i < index->count; i++) free(index->items[i].data);
+    index->count = 0;
+}
+
+
+void snapshot_index_destroy(SnapshotIndex *index) {
+    if (!index) return;
+    snapshot_index_clear(index);
+    free(index);
+}
+
+
+void snapshot_index_start(SnapshotIndex *index, const Scheduler *scheduler, const SchedulerParams *params) {
+    snapshot_index_clear(index);
+    index->interval = index->first_interval;
+    index->next = index->interval;
+    index->scheduler = scheduler;
+    index->params = *params;
+}
+
+
+int snapshot_index_count(const SnapshotIndex *index) {
+    return index->count;
+}
+
+
+void snapshot_record(SnapshotIndex *index, Checkpoint *ck) {
+    if (!ck->clock || *ck->clock < index->next) return;
+
+    if (index->count == SNAPSHOT_MAX) {
+        for (int i = 1; i < SNAPSHOT_MAX; i += 2) free(index->items[i].data);
+        for (int i = 1; i < SNAPSHOT_MAX / 2; i++) index->items[i] = index->items[2 * i];
+        index->count = SNAPSHOT_MAX / 2;
+        index->interval *= 2;
+    }
+
+    size_t size = checkpoint_state_size(ck);
+    unsigned char *data = malloc(size > 0 ? size : 1);
+    if (data == NULL) {
+        /* The snapshots already taken stay usable; replays just start further back. */
+        sim_printf("Memory allocation failed for snapshot\n");
+        index->next = NO_EVENT;
+        return;
+    }
+    checkpoint_save_state(ck, data);
+    index->items[index->count++] = (Snapshot){ *ck->clock, checkpoint_layout(ck), size, data };
+    index->next = *ck->clock + index->interval;
+}
+
+
+/* Loads the last snapshot taken at or before the time looked for, if any. */
+static void seek_restore(SnapshotSeek *seek, Checkpoint *ck) {
+    const SnapshotIndex *index = seek->index;
+    int lo = 0, hi = index->count;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (index->items[mid].time <= seek->time) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == 0) return;
+
+    const Snapshot *s = &index->items[lo - 1];
+    if (s->layout == checkpoint_layout(ck) && s->size == checkpoint_state_size(ck)) {
+        checkpoint_load_state(ck, s->data);
+    }
+}
+
+
+static void* state_alloc(SnapshotSeek *seek, size_t count, size_t size) {
+    void *ptr = calloc(count > 0 ? count : 1, size);
+    if (ptr == NULL) seek->failed = 1;
+    return ptr;
+}
+
+
+static void seek_capture(SnapshotSeek *seek, Checkpoint *ck, int complete) {
+    SimState *state = seek->state;
+    const CheckpointProcesses *procs = &ck->processes;
+    int n = procs->count;
+
+    state->time = complete || !ck->clock ? seek->time : *ck->clock;
+    state->complete = complete;
+    state->process_count = n;
+    state->processes = state_alloc(seek, n, sizeof(ProcessSnapshot));
+    if (state->processes == NULL) return;
+
+    for (int i = 0; i < n; i++) {
+        ProcessSnapshot *p = &state->processes[i];
+        int done, in_io = 0;
+        if (procs->pcbs) {
+            const PCB *pcb = &procs->pcbs[i];
+            p->remaining = pcb->remaining_time;
+            p->executed = pcb->executed_time;
+            p->next_io = pcb->io_index;
+            done = pcb->finished;
+            in_io = pcb->in_io;
+        } else {
+            p->remaining = procs->remaining[i];
+            p->executed = procs->executed[i];
+            p->next_io = procs->next_io[i];
+            done = procs->finished[i];
+        }
+        p->io_left = -1;
+        p->status = done ? PROCESS_DONE : in_io ? PROCESS_BLOCKED : PROCESS_READY;
+    }
+
+    const ArrivalStream *arrivals = ck->arrivals;
+    if (arrivals) {
+        for (int k = arrivals->next; k < arrivals->count; k++) {
+            int i = arrivals->order[k];
+            if (i < n && state->processes[i].status != PROCESS_DONE) state->processes[i].status = PROCESS_NEW;
+        }
+    }
+
+    state->queue_count = ck->queue_count;
+    for (int q = 0; q < ck->queue_count; q++) {
+        const CheckpointQueue *cq = &ck->queues[q];
+        QueueSnapshot *qs = &state->queues[q];
+        qs->name = cq->name;
+        qs->role = cq->role;
+        qs->ids = state_alloc(seek, ready_queue_size(cq->queue), sizeof(int));
+        if (qs->ids == NULL) return;
+        qs->count = ready_queue_order(cq->queue, qs->ids);
+        if (qs->count < 0) {
+            seek->failed = 1;
+            return;
+        }
+        if (cq->role != CHECKPOINT_QUEUE_IO) continue;
+
+        for (int k = 0; k < qs->count; k++) {
+            int i = qs->ids[k];
+            if (i >= n) continue;
+            ProcessSnapshot *p = &state->processes[i];
+            p->status = PROCESS_BLOCKED;
+            if (cq->clock) p->io_left = ready_queue_key(cq->queue, i) - *cq->clock;
+            else if (procs->pcbs) p->io_left = procs->pcbs[i].io_remaining;
+        }
+    }
+    seek->captured = 1;
+}
+
+
+int snapshot_seek_step(SnapshotSeek *seek, Checkpoint *ck) {
+    if (!ck->started) {
+        ck->started = 1;
+        seek_restore(seek, ck);
+    }
+    if (!ck->clock) return 0;
+
+    sim_time_t now = *ck->clock;
+    if (now < seek->time) {
+        seek->last = now;
+        return 0;
+    }
+    if (now == seek->time) {
+        seek_capture(seek, ck, 0);
+        if (seek->failed) sim_fail("Memory allocation failed for simulation state");
+    }
+    else seek->overshot = 1;
+    return 1;
+}
+
+
+void snapshot_seek_end(SnapshotSeek *seek, Checkpoint *ck) {
+    if (seek->captured || seek->overshot || seek->failed) return;
+    seek_capture(seek, ck, 1);
+    if (seek->failed) sim_fail("Memory allocation failed for simulation state");
+}
+
+
+int sim_state_at(const SnapshotIndex *index, const Config *config, const Timeline *timeline,
+                 sim_time_t time, SimState *state) {
+    memset(state, 0, sizeof(SimState));
+    state->running = -2;
+    if (!index->scheduler) return -1;
+
+    SimContext *ctx = sim_context_create(config);
+    if (!ctx) return -1;
+    sim_context_set_console(ctx, NULL);
+
+    SnapshotSeek seek = { index, time > 0 ? time : 0, state, 0, 0, 0, -1 };
+    ctx->seek = &seek;
+    for (;;) {
+        engine_horizon = seek.time;
+        sim_run(ctx, index->scheduler->name, &index->params);
+        engine_horizon = NO_EVENT;
+        if (seek.captured || seek.failed || !seek.overshot || seek.last < 0) break;
+
+        /* A step took the run past time: replay up to the last step before it. */
+        seek.time = seek.last;
+        seek.overshot = 0;
+        seek.last = -1;
+    }
+    sim_context_destroy(ctx);
+    if (!seek.captured) {
+        sim_state_release(state);
+        state->running = -2;
+        return -1;
+    }
+
+    if (timeline) {
+        state->running = GANTT_IDLE;
+        for (int i = 0; i < timeline->slice_count; i++) {
+            const GanttSlice *s = &timeline->slices[i];
+            if (s->start <= state->time && state->time < s->start + s->duration) {
+                state->running = s->process;
+                break;
+            }
+        }
+        int r = state->running;
+        if (r >= 0 && r < state->process_count && state->processes[r].status == PROCESS_READY) {
+            state->processes[r].status = PROCESS_RUNNING;
+        }
+    }
+    return 0;
+}
+
+
+void sim_state_release(SimState *state) {
+    free(state->processes);
+    for (int q = 0; q < state->queue_count; q++) free(state->queues[q].ids);
+    memset(state, 0, sizeof(SimState));
+}
+
+
+const char* process_status_name(ProcessStatus status) {
+    switch (status) {
+        case PROCESS_NEW: return "new";
+        case PROCESS_READY: return "ready";
+        case PROCESS_RUNNING: return "running";
+        case PROCESS_BLOCKED: return "blocked";
+        default: return "done";
+    }
+}
+
+
+static const char* process_name(const Config *config, int i) {
+    return i >= 0 && i < config->process_count ? config->processes[i].ID : "?";
+}
+
+
+void sim_state_print(FILE *out, const SimState *state, const Config *config) {
+    fprintf(out, "time: %lld%s\n", state->time, state->complete ? " (complete)" : "");
+    if (state->running >= 0) fprintf(out, "cpu: %s\n", process_name(config, state->running));
+    else if (state->running == GANTT_IDLE) fprintf(out, "cpu: idle\n");
+
+    for (int q = 0; q < state->queue_count; q++) {
+        const QueueSnapshot *qs = &state->queues[q];
+        fprintf(out, "queue %s:", qs->name);
+        for (int k = 0; k < qs->count; k++) fprintf(out, " %s", process_name(config, qs->ids[k]));
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "process status remaining executed next_io io_left\n");
+    for (int i = 0; i < state->process_count; i++) {
+        const ProcessSnapshot *p = &state->processes[i];
+        fprintf(out, "%s %s %lld %lld %d ", process_name(config, i), process_status_name(p->status),
+                p->remaining, p->executed, p->next_io);
+        if (p->io_left >= 0) fprintf(out, "%lld\n", p->io_left);
+        else fprintf(out, "-\n");
+    }
+}
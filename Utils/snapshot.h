@@ -0,0 +1,105 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef SNAPSHOT_H
+
+#define SNAPSHOT_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./checkpoint.h"
+#include "./sim_context.h"
+#include "./timeline.h"
+
+#define SNAPSHOT_MAX 64
+#define SNAPSHOT_INTERVAL 64
+
+/*
+ * Snapshots of a run, taken in memory at the first step of its main loop
+ * past every interval ticks of its clock. A snapshot holds the regions the
+ * algorithm registered with its Checkpoint, so the state of the run at any
+ * time T is found by replaying it from the last snapshot before T, in
+ * O(interval) steps instead of the whole run. Once SNAPSHOT_MAX are held,
+ * every other one is dropped and the interval doubles: the index of a run
+ * of any length stays bounded.
+ *
+ * A context records the snapshots of its runs into ctx->snapshots, which
+ * sim_run starts over for each run.
+ */
+
+typedef enum {
+    PROCESS_NEW,            /* not arrived yet */
+    PROCESS_READY,
+    PROCESS_RUNNING,
+    PROCESS_BLOCKED,        /* in I/O */
+    PROCESS_DONE
+} ProcessStatus;
+
+typedef struct {
+    ProcessStatus status;
+    sim_time_t remaining;
+    sim_time_t executed;
+    int next_io;            /* index of its next I/O operation */
+    sim_time_t io_left;     /* while blocked, -1 otherwise */
+} ProcessSnapshot;
+
+typedef struct {
+    const char *name;
+    CheckpointQueueRole role;
+    int count;
+    int *ids;               /* in the order they would be served */
+} QueueSnapshot;
+
+/*
+ * State of a run at the start of tick `time`, before the arrivals and I/O
+ * completions of that tick. An algorithm taking several ticks in one step
+ * (the quantum of Multilevel Aging) is seen at the last step starting at
+ * or before the time asked for, which `time` then holds.
+ */
+typedef struct {
+    sim_time_t time;
+    int complete;           /* the run ended before that time */
+    int running;            /* process on the CPU during that tick, GANTT_IDLE or -2 if unknown */
+    int process_count;
+    ProcessSnapshot *processes;
+    int queue_count;
+    QueueSnapshot queues[CHECKPOINT_MAX_QUEUES];
+} SimState;
+
+SnapshotIndex* snapshot_index_create(sim_time_t interval);
+
+void snapshot_index_destroy(SnapshotIndex *index);
+
+/* Drops the snapshots held and records those of a run of scheduler with params. */
+void snapshot_index_start(SnapshotIndex *index, const Scheduler *scheduler, const SchedulerParams *params);
+
+int snapshot_index_count(const SnapshotIndex *index);
+
+/*
+ * The state at `time` of the run the index recorded, on config. The
+ * process on the CPU is read from the timeline of that run, if given.
+ * Returns 0, or -1 if the index holds no run or the state could not be
+ * allocated.
+ */
+int sim_state_at(const SnapshotIndex *index, const Config *config, const Timeline *timeline,
+                 sim_time_t time, SimState *state);
+
+void sim_state_release(SimState *state);
+
+const char* process_status_name(ProcessStatus status);
+
+void sim_state_print(FILE *out, const SimState *state, const Config *config);
+
+/* Called by checkpoint_poll and checkpoint_end. */
+void snapshot_record(SnapshotIndex *index, Checkpoint *ck);
+
+int snapshot_seek_step(SnapshotSeek *seek, Checkpoint *ck);
+
+void snapshot_seek_end(SnapshotSeek *seek, Checkpoint *ck);
+
+#endif
@@ -0,0 +1,225 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sweep.h"
+
+
+const char *sweep_metric_names[SWEEP_METRIC_COUNT] = {
+    "makespan", "avg_waiting", "max_waiting", "p95_waiting", "avg_turnaround", "avg_response",
+    "utilization"
+};
+
+
+int find_sweep_metric(const char *name) {
+    for (int m = 0; m < SWEEP_METRIC_COUNT; m++) {
+        if (strcmp(name, sweep_metric_names[m]) == 0) return m;
+    }
+    return -1;
+}
+
+
+static int parse_value(const char *text, char **end, int *value) {
+    long n = strtol(text, end, 10);
+    if (*end == text || n <= 0 || n > INT_MAX) return 0;
+    *value = (int)n;
+    return 1;
+}
+
+
+static int range_append(ParamRange *range, int value) {
+    if (range->count >= MAX_RANGE_VALUES) return 0;
+    range->values[range->count++] = value;
+    return 1;
+}
+
+
+int parse_param_range(const char *text, ParamRange *range) {
+    const char *p = text;
+    char *end;
+    int first, last, step = 1;
+
+    range->count = 0;
+    if (!parse_value(p, &end, &first)) return 0;
+
+    if (*end == '-') {
+        if (!parse_value(end + 1, &end, &last) || last < first) return 0;
+        if (*end == ':' && !parse_value(end + 1, &end, &step)) return 0;
+        if (*end != '\0') return 0;
+        for (long long v = first; v <= last; v += step) {
+            if (!range_append(range, (int)v)) return 0;
+        }
+        return 1;
+    }
+
+    if (!range_append(range, first)) return 0;
+    while (*end == ',') {
+        int value;
+        if (!parse_value(end + 1, &end, &value) || !range_append(range, value)) return 0;
+    }
+    return *end == '\0';
+}
+
+
+Sweep* sweep_create(const Scheduler *scheduler, const ParamRange *quantum,
+                    const ParamRange *aging_interval, const ParamRange *max_priority) {
+    if (quantum->count == 0 || aging_interval->count == 0 || max_priority->count == 0) return NULL;
+
+    Sweep *sweep = calloc(1, sizeof(Sweep));
+    if (sweep == NULL) {
+        fprintf(stderr, "Memory allocation failed for sweep\n");
+        return NULL;
+    }
+    sweep->scheduler = scheduler;
+    sweep->quantum = *quantum;
+    sweep->aging_interval = *aging_interval;
+    sweep->max_priority = *max_priority;
+    if (!scheduler->needs_quantum) sweep->quantum.count = 1;
+    if (!scheduler->needs_aging) {
+        sweep->aging_interval.count = 1;
+        sweep->max_priority.count = 1;
+    }
+
+    long count = (long)sweep->quantum.count * sweep->aging_interval.count * sweep->max_priority.count;
+    if (count > MAX_SWEEP_POINTS) {
+        fprintf(stderr, "Sweep of %ld points exceeds the limit of %d\n", count, MAX_SWEEP_POINTS);
+        free(sweep);
+        return NULL;
+    }
+
+    sweep->count = (int)count;
+    sweep->results = calloc(count, sizeof(SweepResult));
+    if (sweep->results == NULL) {
+        fprintf(stderr, "Memory allocation failed for %ld sweep points\n", count);
+        free(sweep);
+        return NULL;
+    }
+
+    /* Quantum varies slowest, then aging interval, then max priority. */
+    for (int i = 0; i < sweep->count; i++) {
+        int p = i % sweep->max_priority.count;
+        int a = (i / sweep->max_priority.count) % sweep->aging_interval.count;
+        int q = i / (sweep->max_priority.count * sweep->aging_interval.count);
+        SchedulerParams *params = &sweep->results[i].params;
+        params->quantum = sweep->quantum.values[q];
+        params->aging_interval = sweep->aging_interval.values[a];
+        params->max_priority = sweep->max_priority.values[p];
+    }
+    return sweep;
+}
+
+
+void sweep_destroy(Sweep *sweep) {
+    if (!sweep) return;
+    free(sweep->results);
+    free(sweep);
+}
+
+
+typedef struct {
+    Sweep *sweep;
+    const Config *config;
+} SweepJob;
+
+
+void sweep_evaluate(const Scheduler *scheduler, const Config *config, SweepResult *result) {
+    SimContext *ctx = sim_context_create(config);
+    if (!ctx) return;
+
+    sim_context_set_console(ctx, NULL);
+    /* A run that failed keeps zero metrics, which rank it as stalled. */
+    if (sim_run(ctx, scheduler->name, &result->params) == 0) sim_context_metrics(ctx, &result->metrics);
+    result->utilization = result->metrics.makespan > 0
+        ? (double)result->metrics.busy / result->metrics.makespan : 0;
+    sim_context_destroy(ctx);
+}
+
+
+static void sweep_point(void *arg, int job) {
+    SweepJob *batch = arg;
+    sweep_evaluate(batch->sweep->scheduler, batch->config, &batch->sweep->results[job]);
+}
+
+
+void sweep_run(Sweep *sweep, ThreadPool *pool, const Config *config) {
+    SweepJob batch = { sweep, config };
+    thread_pool_run(pool, sweep->count, sweep_point, &batch);
+}
+
+
+double sweep_metric_value(const SweepResult *result, SweepMetric metric) {
+    switch (metric) {
+        case SWEEP_MAKESPAN:        return (double)result->metrics.makespan;
+        case SWEEP_AVG_WAITING:     return result->metrics.avg_waiting;
+        case SWEEP_MAX_WAITING:     return (double)result->metrics.max_waiting;
+        case SWEEP_P95_WAITING:     return (double)result->metrics.p95_waiting;
+        case SWEEP_AVG_TURNAROUND:  return result->metrics.avg_turnaround;
+        case SWEEP_AVG_RESPONSE:    return result->metrics.avg_response;
+        case SWEEP_UTILIZATION:     return result->utilization;
+        default:                    return 0;
+    }
+}
+
+
+int sweep_best(const Sweep *sweep, SweepMetric metric) {
+    int best = -1;
+    int count = sweep->results[0].metrics.finished;
+
+    /* A point that stalls with processes left never beats a complete one. */
+    for (int i = 1; i < sweep->count; i++) {
+        if (sweep->results[i].metrics.finished > count) count = sweep->results[i].metrics.finished;
+    }
+    for (int i = 0; i < sweep->count; i++) {
+        if (sweep->results[i].metrics.finished < count) continue;
+        if (best < 0) {
+            best = i;
+            continue;
+        }
+        double value = sweep_metric_value(&sweep->results[i], metric);
+        double current = sweep_metric_value(&sweep->results[best], metric);
+        if (metric == SWEEP_UTILIZATION ? value > current : value < current) best = i;
+    }
+    return best;
+}
+
+
+void sweep_print_header(FILE *out) {
+    fprintf(out, "quantum,aging_interval,max_priority,finished,makespan,avg_waiting,max_waiting,"
+                 "p95_waiting,avg_turnaround,avg_response,utilization\n");
+}
+
+
+void sweep_print_row(FILE *out, const SweepResult *r) {
+    fprintf(out, "%d,%d,%d,%d,%lld,%.4f,%lld,%lld,%.4f,%.4f,%.4f\n",
+            r->params.quantum, r->params.aging_interval, r->params.max_priority,
+            r->metrics.finished, r->metrics.makespan, r->metrics.avg_waiting,
+            r->metrics.max_waiting, r->metrics.p95_waiting, r->metrics.avg_turnaround,
+            r->metrics.avg_response, r->utilization);
+}
+
+
+void sweep_print_table(FILE *out, const Sweep *sweep) {
+    sweep_print_header(out);
+    for (int i = 0; i < sweep->count; i++) {
+        sweep_print_row(out, &sweep->results[i]);
+    }
+}
+
+
+void sweep_print_best(FILE *out, const Sweep *sweep) {
+    fprintf(out, "best of %d points for %s:\n", sweep->count, sweep->scheduler->name);
+    for (int m = 0; m < SWEEP_METRIC_COUNT; m++) {
+        int best = sweep_best(sweep, (SweepMetric)m);
+        const SweepResult *r = &sweep->results[best];
+        fprintf(out, "  %-15s %12.4f  quantum=%d aging_interval=%d max_priority=%d\n",
+                sweep_metric_names[m], sweep_metric_value(r, (SweepMetric)m),
+                r->params.quantum, r->params.aging_interval, r->params.max_priority);
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef SWEEP_H
+
+#define SWEEP_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sim_context.h"
+#include "./thread_pool.h"
+
+#define MAX_RANGE_VALUES 1000
+#define MAX_SWEEP_POINTS 100000
+
+/* Values of one parameter: "4", "1-8", "2-32:2" or "3,5,7". */
+typedef struct {
+    int values[MAX_RANGE_VALUES];
+    int count;
+} ParamRange;
+
+typedef enum {
+    SWEEP_MAKESPAN,
+    SWEEP_AVG_WAITING,
+    SWEEP_MAX_WAITING,
+    SWEEP_P95_WAITING,
+    SWEEP_AVG_TURNAROUND,
+    SWEEP_AVG_RESPONSE,
+    SWEEP_UTILIZATION,      /* the only metric where higher is better */
+    SWEEP_METRIC_COUNT
+} SweepMetric;
+
+extern const char *sweep_metric_names[SWEEP_METRIC_COUNT];
+
+typedef struct {
+    SchedulerParams params;
+    SimMetrics metrics;
+    double utilization;
+} SweepResult;
+
+/*
+ * Grid of parameter values for one scheduler. Parameters the scheduler
+ * ignores keep a single value, so they do not multiply the grid. Point
+ * i always holds the same parameters and its run is deterministic, so
+ * the results do not depend on the number of threads.
+ */
+typedef struct {
+    const Scheduler *scheduler;
+    ParamRange quantum;
+    ParamRange aging_interval;
+    ParamRange max_priority;
+    int count;
+    SweepResult *results;
+} Sweep;
+
+int parse_param_range(const char *text, ParamRange *range);
+
+/* Returns NULL if the grid is empty or above MAX_SWEEP_POINTS. */
+Sweep* sweep_create(const Scheduler *scheduler, const ParamRange *quantum,
+                    const ParamRange *aging_interval, const ParamRange *max_priority);
+
+void sweep_destroy(Sweep *sweep);
+
+void sweep_run(Sweep *sweep, ThreadPool *pool, const Config *config);
+
+/* One silent run of the scheduler with result->params. */
+void sweep_evaluate(const Scheduler *scheduler, const Config *config, SweepResult *result);
+
+/* Parses "avg_waiting", "p95_waiting", ...; -1 if unknown. */
+int find_sweep_metric(const char *name);
+
+double sweep_metric_value(const SweepResult *result, SweepMetric metric);
+
+/* Index of the best point for the metric; ties go to the first point. */
+int sweep_best(const Sweep *sweep, SweepMetric metric);
+
+void sweep_print_header(FILE *out);
+
+void sweep_print_row(FILE *out, const SweepResult *result);
+
+void sweep_print_table(FILE *out, const Sweep *sweep);
+
+void sweep_print_best(FILE *out, const Sweep *sweep);
+
+#endif
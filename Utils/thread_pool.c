@@ -0,0 +1,139 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "thread_pool.h"
+
+
+struct ThreadPool {
+    pthread_t *threads;
+    int size;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+
+    pool_job_fn fn;
+    void *arg;
+    int jobs;
+    int next_job;
+    int pending;
+    int stopping;
+};
+
+
+int thread_pool_default_size(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+
+static void* worker_main(void *data) {
+    ThreadPool *pool = data;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->stopping && pool->next_job >= pool->jobs) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->stopping) break;
+
+        int job = pool->next_job++;
+        pthread_mutex_unlock(&pool->lock);
+
+        pool->fn(pool->arg, job);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+
+ThreadPool* thread_pool_create(int size) {
+    if (size <= 0) size = thread_pool_default_size();
+
+    ThreadPool *pool = calloc(1, sizeof(ThreadPool));
+    if (pool == NULL) {
+        fprintf(stderr, "Memory allocation failed for thread pool\n");
+        return NULL;
+    }
+    pool->threads = calloc(size, sizeof(pthread_t));
+    if (pool->threads == NULL) {
+        fprintf(stderr, "Memory allocation failed for thread pool\n");
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    for (int i = 0; i < size; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_main, pool) != 0) {
+            fprintf(stderr, "Could not start worker thread %d\n", i);
+            break;
+        }
+        pool->size++;
+    }
+    if (pool->size == 0) {
+        thread_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+
+void thread_pool_destroy(ThreadPool *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->size; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+
+int thread_pool_size(const ThreadPool *pool) {
+    return pool->size;
+}
+
+
+void thread_pool_run(ThreadPool *pool, int jobs, pool_job_fn fn, void *arg) {
+    if (jobs <= 0) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->arg = arg;
+    pool->jobs = jobs;
+    pool->next_job = 0;
+    pool->pending = jobs;
+    pthread_cond_broadcast(&pool->work_ready);
+
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pool->jobs = 0;
+    pool->next_job = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
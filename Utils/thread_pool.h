@@ -0,0 +1,33 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef THREAD_POOL_H
+
+#define THREAD_POOL_H
+
+/*
+ * Fixed set of worker threads kept for many batches of jobs. A batch is
+ * jobs 0 .. jobs-1 of one function; each worker takes the next job not
+ * started yet, and thread_pool_run returns when the batch is done. One
+ * batch runs at a time.
+ */
+typedef struct ThreadPool ThreadPool;
+
+typedef void (*pool_job_fn)(void *arg, int job);
+
+int thread_pool_default_size(void);
+
+/* size <= 0 uses one thread per online CPU. */
+ThreadPool* thread_pool_create(int size);
+
+void thread_pool_destroy(ThreadPool *pool);
+
+int thread_pool_size(const ThreadPool *pool);
+
+void thread_pool_run(ThreadPool *pool, int jobs, pool_job_fn fn, void *arg);
+
+#endif
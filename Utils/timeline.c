@@ -0,0 +1,181 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "timeline.h"
+
+
+static const char* IO_COLOR_PALETTE[] = {
+    "#5dade2", "#ec7063", "#58d68d", "#f8c471", "#af7ac5",
+    "#48c9b0", "#eb984e", "#5d6d7e", "#45b39d", "#cd6155",
+    "#52be80", "#5499c7", "#a569bd", "#dc7633", "#95a5a6"
+};
+static const int IO_COLOR_COUNT = 15;
+
+
+/* array, of *capacity items of size bytes, grown to hold count items; NULL if it cannot be. */
+static void* slices_reserve(void *array, int *capacity, int count, size_t size) {
+    if (count <= *capacity) return array;
+
+    int grown = *capacity > 0 ? *capacity : 64;
+    while (grown < count) {
+        grown *= 2;
+    }
+
+    void *slices = realloc(array, (size_t)grown * size);
+    if (slices != NULL) *capacity = grown;
+    return slices;
+}
+
+
+int timeline_add_slice(Timeline *t, int process, sim_time_t start, sim_time_t duration, const char* color) {
+    GanttSlice *last = t->slice_count > 0 ? &t->slices[t->slice_count - 1] : NULL;
+    if (last && 
+        last->process == process && 
+        (last->start + last->duration) == start) {
+        last->duration += duration;
+    } else {
+        GanttSlice *slices = slices_reserve(t->slices, &t->slice_capacity, t->slice_count + 1, sizeof(GanttSlice));
+        if (slices == NULL) {
+            t->dropped++;
+            return 0;
+        }
+        t->slices = slices;
+        // Add new slice
+        GanttSlice *slice = &t->slices[t->slice_count];
+        slice->process = process;
+        slice->start = start;
+        slice->duration = duration;
+        slice->color = color;
+        t->slice_count++;
+    }
+    return 1;
+}
+
+
+int timeline_add_io_slice(Timeline *t, int process, sim_time_t start, sim_time_t duration, const char* color, const char* io_type) {
+    IOSlice *io_slices = slices_reserve(t->io_slices, &t->io_slice_capacity, t->io_slice_count + 1, sizeof(IOSlice));
+    if (io_slices == NULL) {
+        t->dropped++;
+        return 0;
+    }
+    t->io_slices = io_slices;
+
+    IOSlice *slice = &t->io_slices[t->io_slice_count];
+    slice->process = process;
+    slice->start = start;
+    slice->duration = duration;
+    slice->color = color ? color : IO_COLOR_PALETTE[t->io_slice_count % IO_COLOR_COUNT];
+    
+    if (io_type) {
+        strncpy(slice->io_type, io_type, 31);
+        slice->io_type[31] = '\0';
+    } else {
+        strcpy(slice->io_type, "I/O");
+    }
+    
+    t->io_slice_count++;
+    return 1;
+}
+
+
+void timeline_clear_slices(Timeline *t) {
+    t->slice_count = 0;
+    t->dropped = 0;
+}
+
+
+void timeline_clear_io_slices(Timeline *t) {
+    t->io_slice_count = 0;
+}
+
+
+void timeline_release(Timeline *t) {
+    free(t->slices);
+    free(t->io_slices);
+    memset(t, 0, sizeof(*t));
+}
+
+
+void timeline_export(const Timeline *t, SliceRecord *records) {
+    memset(records, 0, ((size_t)t->slice_count + t->io_slice_count) * sizeof(SliceRecord));
+    for (int i = 0; i < t->slice_count; i++) {
+        const GanttSlice *s = &t->slices[i];
+        SliceRecord *r = &records[i];
+        r->process = s->process;
+        r->start = s->start;
+        r->duration = s->duration;
+        snprintf(r->color, sizeof(r->color), "%s", s->color ? s->color : "");
+    }
+    for (int i = 0; i < t->io_slice_count; i++) {
+        const IOSlice *s = &t->io_slices[i];
+        SliceRecord *r = &records[t->slice_count + i];
+        r->process = s->process;
+        r->start = s->start;
+        r->duration = s->duration;
+        snprintf(r->color, sizeof(r->color), "%s", s->color ? s->color : "");
+        snprintf(r->io_type, sizeof(r->io_type), "%s", s->io_type);
+    }
+}
+
+
+int timeline_import(Timeline *t, const SliceRecord *records, int slice_count, int io_slice_count, int dropped) {
+    timeline_clear_slices(t);
+    timeline_clear_io_slices(t);
+    if (slice_count > 0) {
+        GanttSlice *slices = slices_reserve(t->slices, &t->slice_capacity, slice_count, sizeof(GanttSlice));
+        if (slices == NULL) return 0;
+        t->slices = slices;
+    }
+    if (io_slice_count > 0) {
+        IOSlice *io_slices = slices_reserve(t->io_slices, &t->io_slice_capacity, io_slice_count, sizeof(IOSlice));
+        if (io_slices == NULL) return 0;
+        t->io_slices = io_slices;
+    }
+    for (int i = 0; i < slice_count; i++) {
+        const SliceRecord *r = &records[i];
+        t->slices[i] = (GanttSlice){ r->process, r->start, r->duration, timeline_color(r->color) };
+    }
+    for (int i = 0; i < io_slice_count; i++) {
+        const SliceRecord *r = &records[slice_count + i];
+        IOSlice *slice = &t->io_slices[i];
+        slice->process = r->process;
+        slice->start = r->start;
+        slice->duration = r->duration;
+        slice->color = timeline_color(r->color);
+        snprintf(slice->io_type, sizeof(slice->io_type), "%s", r->io_type);
+    }
+    t->slice_count = slice_count;
+    t->io_slice_count = io_slice_count;
+    t->dropped = dropped;
+    return 1;
+}
+
+
+/* Slices point to their color, so colors read back from files are interned. */
+const char* timeline_color(const char *text) {
+    static char colors[64][16];
+    static int count = 0;
+    static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    if (!text[0]) return NULL;
+
+    const char *found = NULL;
+    pthread_mutex_lock(&lock);
+    for (int i = 0; i < count && !found; i++) {
+        if (strcmp(colors[i], text) == 0) found = colors[i];
+    }
+    if (!found && count < 64) {
+        snprintf(colors[count], sizeof(colors[count]), "%s", text);
+        found = colors[count++];
+    }
+    pthread_mutex_unlock(&lock);
+    return found;
+}
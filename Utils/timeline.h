@@ -0,0 +1,79 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef TIMELINE_H
+
+#define TIMELINE_H
+
+#include "../Config/types.h"
+
+/* Slices carry the process handle (its index in the process table). */
+#define GANTT_IDLE -1
+
+
+typedef struct {
+    int process;
+    sim_time_t start;
+    sim_time_t duration;
+    const char* color;
+} GanttSlice;
+
+
+typedef struct {
+    int process;
+    sim_time_t start;
+    sim_time_t duration;
+    const char* color;
+    char io_type[32]; 
+} IOSlice;
+
+/*
+ * CPU and I/O slices recorded by one simulation run, in arrays grown
+ * geometrically as the run adds slices.
+ */
+typedef struct {
+    GanttSlice *slices;
+    int slice_count;
+    int slice_capacity;
+
+    IOSlice *io_slices;
+    int io_slice_count;
+    int io_slice_capacity;
+
+    int dropped;            /* slices lost for want of memory */
+} Timeline;
+
+/* A slice with its color as text, for timelines written to files. */
+typedef struct {
+    int process;
+    sim_time_t start;
+    sim_time_t duration;
+    char color[16];         /* empty for the process color */
+    char io_type[32];
+} SliceRecord;
+
+/* The add functions return 0, and count the slice as dropped, if the arrays cannot grow. */
+int timeline_add_slice(Timeline *t, int process, sim_time_t start, sim_time_t duration, const char* color);
+
+int timeline_add_io_slice(Timeline *t, int process, sim_time_t start, sim_time_t duration, const char* color, const char* io_type);
+
+void timeline_clear_slices(Timeline *t);
+
+void timeline_clear_io_slices(Timeline *t);
+
+/* Writes the CPU slices then the I/O slices, slice_count + io_slice_count records. */
+void timeline_export(const Timeline *t, SliceRecord *records);
+
+/* Returns 0, leaving t empty, if the slices do not fit in memory. */
+int timeline_import(Timeline *t, const SliceRecord *records, int slice_count, int io_slice_count, int dropped);
+
+void timeline_release(Timeline *t);
+
+/* The color named text, kept for the life of the program; NULL for an empty text. */
+const char* timeline_color(const char *text);
+
+#endif
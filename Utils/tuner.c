@@ -0,0 +1,331 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "tuner.h"
+
+
+static double throughput(const SweepResult *point) {
+    return point->metrics.makespan > 0 ? (double)point->metrics.finished / point->metrics.makespan : 0;
+}
+
+
+int tuner_feasible(const Tuner *tuner, const SweepResult *point) {
+    return point->metrics.finished == tuner->process_count &&
+           throughput(point) >= tuner->spec.min_throughput;
+}
+
+
+static int params_before(const SchedulerParams *a, const SchedulerParams *b) {
+    if (a->quantum != b->quantum) return a->quantum < b->quantum;
+    if (a->aging_interval != b->aging_interval) return a->aging_interval < b->aging_interval;
+    return a->max_priority < b->max_priority;
+}
+
+
+/* Feasible points first, then the objective; ties go to the smaller parameters. */
+static int better(const Tuner *tuner, const SweepResult *a, const SweepResult *b) {
+    int feasible_a = tuner_feasible(tuner, a);
+    int feasible_b = tuner_feasible(tuner, b);
+    if (feasible_a != feasible_b) return feasible_a;
+
+    if (!feasible_a) {
+        if (a->metrics.finished != b->metrics.finished) return a->metrics.finished > b->metrics.finished;
+        if (throughput(a) != throughput(b)) return throughput(a) > throughput(b);
+        return params_before(&a->params, &b->params);
+    }
+
+    SweepMetric objective = tuner->spec.objective;
+    double value_a = sweep_metric_value(a, objective);
+    double value_b = sweep_metric_value(b, objective);
+    if (value_a != value_b) {
+        return objective == SWEEP_UTILIZATION ? value_a > value_b : value_a < value_b;
+    }
+    return params_before(&a->params, &b->params);
+}
+
+
+static void sort_unique(ParamRange *range) {
+    for (int i = 1; i < range->count; i++) {
+        int value = range->values[i];
+        int j = i - 1;
+        while (j >= 0 && range->values[j] > value) {
+            range->values[j + 1] = range->values[j];
+            j--;
+        }
+        range->values[j + 1] = value;
+    }
+
+    int count = 0;
+    for (int i = 0; i < range->count; i++) {
+        if (count == 0 || range->values[i] != range->values[count - 1]) {
+            range->values[count++] = range->values[i];
+        }
+    }
+    range->count = count;
+}
+
+
+static ParamRange* dimension(Tuner *tuner, int dim) {
+    if (dim == 0) return &tuner->spec.quantum;
+    if (dim == 1) return &tuner->spec.aging_interval;
+    return &tuner->spec.max_priority;
+}
+
+
+static SchedulerParams params_at(Tuner *tuner, const int *at) {
+    SchedulerParams params = {
+        tuner->spec.quantum.values[at[0]],
+        tuner->spec.aging_interval.values[at[1]],
+        tuner->spec.max_priority.values[at[2]]
+    };
+    return params;
+}
+
+
+static int find_point(const Tuner *tuner, const SchedulerParams *params) {
+    for (int i = 0; i < tuner->count; i++) {
+        const SchedulerParams *p = &tuner->points[i].params;
+        if (p->quantum == params->quantum && p->aging_interval == params->aging_interval &&
+            p->max_priority == params->max_priority) return i;
+    }
+    return -1;
+}
+
+
+typedef struct {
+    const Scheduler *scheduler;
+    const Config *config;
+    SweepResult *points;
+} TunerBatch;
+
+
+static void tuner_point(void *arg, int job) {
+    TunerBatch *batch = arg;
+    sweep_evaluate(batch->scheduler, batch->config, &batch->points[job]);
+}
+
+
+/* Runs the candidates not evaluated yet in parallel; indices[i] receives each point. */
+static int evaluate(Tuner *tuner, ThreadPool *pool, const Config *config,
+                    const SchedulerParams *candidates, int n, int *indices) {
+    if (tuner->count + n > tuner->capacity) {
+        int capacity = tuner->capacity > 0 ? tuner->capacity : 64;
+        while (capacity < tuner->count + n) capacity *= 2;
+
+        SweepResult *points = realloc(tuner->points, capacity * sizeof(SweepResult));
+        if (points == NULL) {
+            fprintf(stderr, "Memory allocation failed for %d tuner points\n", capacity);
+            return 0;
+        }
+        tuner->points = points;
+        tuner->capacity = capacity;
+    }
+
+    int start = tuner->count;
+    for (int i = 0; i < n; i++) {
+        indices[i] = find_point(tuner, &candidates[i]);
+        if (indices[i] < 0) {
+            memset(&tuner->points[tuner->count], 0, sizeof(SweepResult));
+            tuner->points[tuner->count].params = candidates[i];
+            indices[i] = tuner->count++;
+        }
+    }
+
+    TunerBatch batch = { tuner->spec.scheduler, config, tuner->points + start };
+    thread_pool_run(pool, tuner->count - start, tuner_point, &batch);
+    return 1;
+}
+
+
+/*
+ * Interval search along one parameter, the others fixed: evaluate evenly
+ * spaced candidates, keep the span around the best one and repeat until
+ * the span is small enough to evaluate entirely. Returns the best point.
+ */
+static int search_dimension(Tuner *tuner, ThreadPool *pool, const Config *config, const int *from, int dim) {
+    int lo = 0;
+    int hi = dimension(tuner, dim)->count - 1;
+    int at[3] = { from[0], from[1], from[2] };
+
+    for (;;) {
+        int span = hi - lo + 1;
+        int n = span <= TUNER_POINTS_PER_ROUND ? span : TUNER_POINTS_PER_ROUND;
+        int positions[TUNER_POINTS_PER_ROUND];
+        SchedulerParams candidates[TUNER_POINTS_PER_ROUND];
+        int indices[TUNER_POINTS_PER_ROUND];
+
+        for (int j = 0; j < n; j++) {
+            positions[j] = span <= TUNER_POINTS_PER_ROUND
+                ? lo + j : lo + (int)((long)j * (hi - lo) / (TUNER_POINTS_PER_ROUND - 1));
+            at[dim] = positions[j];
+            candidates[j] = params_at(tuner, at);
+        }
+        if (!evaluate(tuner, pool, config, candidates, n, indices)) return -1;
+
+        int best = 0;
+        for (int j = 1; j < n; j++) {
+            if (better(tuner, &tuner->points[indices[j]], &tuner->points[indices[best]])) best = j;
+        }
+        if (span <= TUNER_POINTS_PER_ROUND) return indices[best];
+
+        int new_lo = best > 0 ? positions[best - 1] : lo;
+        int new_hi = best < n - 1 ? positions[best + 1] : hi;
+        lo = new_lo;
+        hi = new_hi;
+    }
+}
+
+
+static int value_index(const ParamRange *range, int value) {
+    for (int i = 0; i < range->count; i++) {
+        if (range->values[i] == value) return i;
+    }
+    return 0;
+}
+
+
+Tuner* tuner_run(const TunerSpec *spec, ThreadPool *pool, const Config *config) {
+    Tuner *tuner = calloc(1, sizeof(Tuner));
+    if (tuner == NULL) {
+        fprintf(stderr, "Memory allocation failed for tuner\n");
+        return NULL;
+    }
+    tuner->spec = *spec;
+    tuner->process_count = config->process_count;
+
+    int active[3] = { spec->scheduler->needs_quantum, spec->scheduler->needs_aging, spec->scheduler->needs_aging };
+    int at[3];
+    tuner->grid_size = 1;
+    for (int dim = 0; dim < 3; dim++) {
+        ParamRange *range = dimension(tuner, dim);
+        sort_unique(range);
+        if (range->count == 0) {
+            tuner_destroy(tuner);
+            return NULL;
+        }
+        if (!active[dim]) range->count = 1;
+        tuner->grid_size *= range->count;
+        at[dim] = range->count / 2;
+    }
+
+    SchedulerParams start = params_at(tuner, at);
+    int current;
+    if (!evaluate(tuner, pool, config, &start, 1, &current)) {
+        tuner_destroy(tuner);
+        return NULL;
+    }
+
+    /* Coordinate search: one interval search per parameter, until a pass brings nothing. */
+    for (int pass = 0; pass < TUNER_MAX_PASSES; pass++) {
+        int improved = 0;
+        int searched = 0;
+        for (int dim = 0; dim < 3; dim++) {
+            if (dimension(tuner, dim)->count < 2) continue;
+            searched++;
+
+            int found = search_dimension(tuner, pool, config, at, dim);
+            if (found < 0) {
+                tuner_destroy(tuner);
+                return NULL;
+            }
+            if (better(tuner, &tuner->points[found], &tuner->points[current])) {
+                current = found;
+                improved = 1;
+                const SchedulerParams *p = &tuner->points[found].params;
+                at[0] = value_index(&tuner->spec.quantum, p->quantum);
+                at[1] = value_index(&tuner->spec.aging_interval, p->aging_interval);
+                at[2] = value_index(&tuner->spec.max_priority, p->max_priority);
+            }
+        }
+        if (!improved || searched <= 1) break;
+    }
+
+    tuner->best = 0;
+    for (int i = 1; i < tuner->count; i++) {
+        if (better(tuner, &tuner->points[i], &tuner->points[tuner->best])) tuner->best = i;
+    }
+    return tuner;
+}
+
+
+void tuner_destroy(Tuner *tuner) {
+    if (!tuner) return;
+    free(tuner->points);
+    free(tuner);
+}
+
+
+/* Complete runs no other complete run beats on both the objective and the throughput. */
+static int on_frontier(const Tuner *tuner, int i) {
+    const SweepResult *a = &tuner->points[i];
+    if (a->metrics.finished != tuner->process_count) return 0;
+
+    int maximize = tuner->spec.objective == SWEEP_UTILIZATION;
+    double value_a = sweep_metric_value(a, tuner->spec.objective);
+    for (int j = 0; j < tuner->count; j++) {
+        const SweepResult *b = &tuner->points[j];
+        if (j == i || b->metrics.finished != tuner->process_count) continue;
+
+        double value_b = sweep_metric_value(b, tuner->spec.objective);
+        int objective_ok = maximize ? value_b >= value_a : value_b <= value_a;
+        int objective_strict = value_b != value_a;
+        int throughput_ok = throughput(b) >= throughput(a);
+        int throughput_strict = throughput(b) != throughput(a);
+        if (objective_ok && throughput_ok && (objective_strict || throughput_strict)) return 0;
+        if (!objective_strict && !throughput_strict && better(tuner, b, a)) return 0;
+    }
+    return 1;
+}
+
+
+void tuner_print(FILE *out, const Tuner *tuner) {
+    const SweepResult *best = &tuner->points[tuner->best];
+    const char *objective = sweep_metric_names[tuner->spec.objective];
+
+    fprintf(out, "tuned %s for %s", tuner->spec.scheduler->name, objective);
+    if (tuner->spec.min_throughput > 0) fprintf(out, " with throughput >= %g", tuner->spec.min_throughput);
+    fprintf(out, ": %d runs out of %ld grid points\n", tuner->count, tuner->grid_size);
+
+    fprintf(out, "best:");
+    if (tuner->spec.scheduler->needs_quantum) fprintf(out, " quantum=%d", best->params.quantum);
+    if (tuner->spec.scheduler->needs_aging) {
+        fprintf(out, " aging_interval=%d max_priority=%d", best->params.aging_interval, best->params.max_priority);
+    }
+    fprintf(out, " %s=%.4f throughput=%.6f%s\n\n",
+            objective, sweep_metric_value(best, tuner->spec.objective), throughput(best),
+            tuner_feasible(tuner, best) ? "" : " (constraint not met)");
+
+    int *frontier = malloc(tuner->count * sizeof(int));
+    if (frontier == NULL) return;
+
+    /* Sorted from the best objective value to the best throughput. */
+    int maximize = tuner->spec.objective == SWEEP_UTILIZATION;
+    int size = 0;
+    for (int i = 0; i < tuner->count; i++) {
+        if (!on_frontier(tuner, i)) continue;
+
+        double value = sweep_metric_value(&tuner->points[i], tuner->spec.objective);
+        int j = size++;
+        while (j > 0) {
+            double previous = sweep_metric_value(&tuner->points[frontier[j - 1]], tuner->spec.objective);
+            if (maximize ? value <= previous : value >= previous) break;
+            frontier[j] = frontier[j - 1];
+            j--;
+        }
+        frontier[j] = i;
+    }
+
+    fprintf(out, "frontier (%s vs throughput):\n", objective);
+    sweep_print_header(out);
+    for (int i = 0; i < size; i++) {
+        sweep_print_row(out, &tuner->points[frontier[i]]);
+    }
+    free(frontier);
+}
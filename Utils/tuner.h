@@ -0,0 +1,55 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef TUNER_H
+
+#define TUNER_H
+
+#include <stdio.h>
+#include "../Config/config.h"
+#include "./Algorithms.h"
+#include "./sweep.h"
+#include "./thread_pool.h"
+
+/* Points evaluated per round of the interval search, whatever the pool size. */
+#define TUNER_POINTS_PER_ROUND 8
+#define TUNER_MAX_PASSES 4
+
+/*
+ * Search of the parameters the scheduler uses, among the candidate
+ * values of each range, for the lowest objective (highest for
+ * utilization). A point is feasible when every process finishes and
+ * the throughput (processes per tick) reaches min_throughput.
+ */
+typedef struct {
+    const Scheduler *scheduler;
+    SweepMetric objective;
+    double min_throughput;
+    ParamRange quantum;
+    ParamRange aging_interval;
+    ParamRange max_priority;
+} TunerSpec;
+
+typedef struct {
+    TunerSpec spec;
+    int process_count;
+    SweepResult *points;    /* every evaluated point, in evaluation order */
+    int count;
+    int capacity;
+    int best;
+    long grid_size;
+} Tuner;
+
+Tuner* tuner_run(const TunerSpec *spec, ThreadPool *pool, const Config *config);
+
+void tuner_destroy(Tuner *tuner);
+
+int tuner_feasible(const Tuner *tuner, const SweepResult *point);
+
+void tuner_print(FILE *out, const Tuner *tuner);
+
+#endif
@@ -0,0 +1,403 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "./variant_batch.h"
+#include "./engine.h"
+#include "./io_timer.h"
+#include "./sim_context.h"
+#include "./rng.h"
+
+#define VARIANT_TIMES 7
+#define VARIANT_FLAGS 5
+#define LANE_TIMES 4
+#define LANE_FLAGS 6
+
+VariantBatch* variant_batch_create(Config *config, int lanes) {
+    if (lanes <= 0) return NULL;
+
+    int n = config->process_count;
+    int count = n > 0 ? n : 1;
+    size_t slots = (size_t)count * lanes;
+    VariantBatch *b = malloc(sizeof(VariantBatch));
+    sim_time_t *block = malloc(slots * (VARIANT_TIMES * sizeof(sim_time_t) + VARIANT_FLAGS * sizeof(int)) +
+                               lanes * (LANE_TIMES * sizeof(sim_time_t) + LANE_FLAGS * sizeof(int)) +
+                               count * sizeof(int));
+    if (b == NULL || block == NULL) {
+        free(b);
+        free(block);
+        return NULL;
+    }
+
+    b->config = config;
+    b->count = n;
+    b->lanes = lanes;
+
+    b->arrival = block;
+    b->burst = block + slots;
+    b->remaining = block + 2 * slots;
+    b->executed = block + 3 * slots;
+    b->io_due = block + 4 * slots;
+    b->completion = block + 5 * slots;
+    b->first_run = block + 6 * slots;
+
+    sim_time_t *lane_times = block + VARIANT_TIMES * slots;
+    b->wake = lane_times;
+    b->used_quantum = lane_times + lanes;
+    b->busy = lane_times + 2 * lanes;
+    b->io_busy_until = lane_times + 3 * lanes;
+
+    int *flags = (int*)(lane_times + LANE_TIMES * lanes);
+    b->io_index = flags;
+    b->finished = flags + slots;
+    b->order = flags + 2 * slots;
+    b->ready = flags + 3 * slots;
+    b->io_queue = flags + 4 * slots;
+
+    int *lane_flags = flags + VARIANT_FLAGS * slots;
+    b->next_arrival = lane_flags;
+    b->ready_head = lane_flags + lanes;
+    b->ready_size = lane_flags + 2 * lanes;
+    b->io_head = lane_flags + 3 * lanes;
+    b->io_size = lane_flags + 4 * lanes;
+    b->finished_count = lane_flags + 5 * lanes;
+    b->sort_order = lane_flags + LANE_FLAGS * lanes;
+
+    for (int i = 0; i < n; i++) {
+        for (int lane = 0; lane < lanes; lane++) {
+            b->arrival[VARIANT_AT(b, i, lane)] = config->processes[i].arrival_time;
+            b->burst[VARIANT_AT(b, i, lane)] = config->processes[i].execution_time;
+        }
+    }
+    return b;
+}
+
+void variant_batch_destroy(VariantBatch *b) {
+    if (!b) return;
+    free(b->arrival);
+    free(b);
+}
+
+
+static unsigned long long variant_seed(unsigned int seed) {
+    unsigned long long state = seed ^ 0x9E3779B97F4A7C15ULL;
+    return state ? state : 1;
+}
+
+void variant_batch_jitter_arrivals(VariantBatch *b, sim_time_t max_shift, unsigned int seed) {
+    unsigned long long state = variant_seed(seed);
+
+    for (int lane = 1; lane < b->lanes; lane++) {
+        for (int i = 0; i < b->count; i++) {
+            sim_time_t *arrival = &b->arrival[VARIANT_AT(b, i, lane)];
+            sim_time_t shift = (sim_time_t)(rng_next_double(&state) * (2 * max_shift + 1)) - max_shift;
+            *arrival = *arrival + shift > 0 ? *arrival + shift : 0;
+        }
+    }
+}
+
+void variant_batch_scale_bursts(VariantBatch *b, double min_scale, double max_scale, unsigned int seed) {
+    unsigned long long state = variant_seed(seed);
+
+    for (int lane = 1; lane < b->lanes; lane++) {
+        for (int i = 0; i < b->count; i++) {
+            sim_time_t *burst = &b->burst[VARIANT_AT(b, i, lane)];
+            double scale = min_scale + rng_next_double(&state) * (max_scale - min_scale);
+            sim_time_t scaled = (sim_time_t)(*burst * scale + 0.5);
+            *burst = (*burst > 0 && scaled < 1) ? 1 : scaled;
+        }
+    }
+}
+
+
+static int arrives_before(VariantBatch *b, int lane, int x, int y) {
+    sim_time_t ax = b->arrival[VARIANT_AT(b, x, lane)];
+    sim_time_t ay = b->arrival[VARIANT_AT(b, y, lane)];
+    if (ax != ay) return ax < ay;
+    return x < y;
+}
+
+static void arrival_sift_down(VariantBatch *b, int lane, int *order, int index, int count) {
+    int id = order[index];
+    for (;;) {
+        int child = 2 * index + 1;
+        if (child >= count) break;
+        if (child + 1 < count && arrives_before(b, lane, order[child], order[child + 1])) {
+            child++;
+        }
+        if (!arrives_before(b, lane, id, order[child])) break;
+        order[index] = order[child];
+        index = child;
+    }
+    order[index] = id;
+}
+
+/* Same (arrival, index) order as config_sort_arrivals, for one lane. */
+static void sort_lane_arrivals(VariantBatch *b, int lane) {
+    int *order = b->sort_order;
+    int count = b->count;
+
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        arrival_sift_down(b, lane, order, i, count);
+    }
+    for (int end = count - 1; end > 0; end--) {
+        int last = order[end];
+        order[end] = order[0];
+        order[0] = last;
+        arrival_sift_down(b, lane, order, 0, end);
+    }
+    for (int i = 0; i < count; i++) {
+        b->order[VARIANT_AT(b, i, lane)] = order[i];
+    }
+}
+
+static void reset_lanes(VariantBatch *b) {
+    for (int i = 0; i < b->count * b->lanes; i++) {
+        b->remaining[i] = b->burst[i];
+        b->executed[i] = 0;
+        b->io_due[i] = 0;
+        b->completion[i] = -1;
+        b->first_run[i] = -1;
+        b->io_index[i] = 0;
+        b->finished[i] = 0;
+    }
+    for (int lane = 0; lane < b->lanes; lane++) {
+        b->wake[lane] = 0;
+        b->used_quantum[lane] = 0;
+        b->busy[lane] = 0;
+        b->io_busy_until[lane] = 0;
+        b->next_arrival[lane] = 0;
+        b->ready_head[lane] = 0;
+        b->ready_size[lane] = 0;
+        b->io_head[lane] = 0;
+        b->io_size[lane] = 0;
+        b->finished_count[lane] = 0;
+        sort_lane_arrivals(b, lane);
+    }
+}
+
+
+static void ready_push(VariantBatch *b, int lane, int i) {
+    int slot = (b->ready_head[lane] + b->ready_size[lane]) % b->count;
+    b->ready[VARIANT_AT(b, slot, lane)] = i;
+    b->ready_size[lane]++;
+}
+
+static void ready_pop(VariantBatch *b, int lane) {
+    b->ready_head[lane] = (b->ready_head[lane] + 1) % b->count;
+    b->ready_size[lane]--;
+}
+
+static void io_push(VariantBatch *b, int lane, int i) {
+    int slot = (b->io_head[lane] + b->io_size[lane]) % b->count;
+    b->io_queue[VARIANT_AT(b, slot, lane)] = i;
+    b->io_size[lane]++;
+}
+
+static void io_pop(VariantBatch *b, int lane) {
+    b->io_head[lane] = (b->io_head[lane] + 1) % b->count;
+    b->io_size[lane]--;
+}
+
+static const IO_OPERATION* lane_next_io(VariantBatch *b, int lane, int i) {
+    const PROCESS *p = &b->config->processes[i];
+    int io_index = b->io_index[VARIANT_AT(b, i, lane)];
+    if (io_index >= p->io_count) return NULL;
+    return &process_io(b->config, p)[io_index];
+}
+
+/*
+ * One tick of RoundRobin_Algo for one lane, followed by the quiet ticks
+ * up to its next event; b->wake[lane] is set to the next tick to simulate.
+ */
+static void round_robin_step(VariantBatch *b, int lane, sim_time_t time, int quantum) {
+    int n = b->count;
+
+    while (b->next_arrival[lane] < n) {
+        int i = b->order[VARIANT_AT(b, b->next_arrival[lane], lane)];
+        sim_time_t arrival = b->arrival[VARIANT_AT(b, i, lane)];
+        if (arrival > time) break;
+        b->next_arrival[lane]++;
+        if (!b->finished[VARIANT_AT(b, i, lane)]) {
+            ready_push(b, lane, i);
+        }
+    }
+
+    if (b->io_size[lane] > 0) {
+        int i = b->io_queue[VARIANT_AT(b, b->io_head[lane], lane)];
+        int at = VARIANT_AT(b, i, lane);
+
+        if (b->io_due[at] <= time) {
+            io_pop(b, lane);
+            b->io_index[at]++;
+            ready_push(b, lane, i);
+        }
+    }
+
+    if (b->ready_size[lane] > 0) {
+        int i = b->ready[VARIANT_AT(b, b->ready_head[lane], lane)];
+        int at = VARIANT_AT(b, i, lane);
+        const IO_OPERATION *io = lane_next_io(b, lane, i);
+
+        if (b->first_run[at] < 0) b->first_run[at] = time;
+        b->executed[at]++;
+        b->remaining[at]--;
+        b->used_quantum[lane]++;
+        b->busy[lane]++;
+
+        if (io != NULL && b->executed[at] == io->start_time) {
+            b->io_due[at] = io_timer_due_serial(time, &b->io_busy_until[lane], io->duration + 1);
+            ready_pop(b, lane);
+            io_push(b, lane, i);
+            b->used_quantum[lane] = 0;
+        } else if (b->remaining[at] <= 0) {
+            b->finished[at] = 1;
+            b->completion[at] = time + 1;
+            b->finished_count[lane]++;
+            ready_pop(b, lane);
+            b->used_quantum[lane] = 0;
+        } else if (b->used_quantum[lane] >= quantum) {
+            ready_pop(b, lane);
+            ready_push(b, lane, i);
+            b->used_quantum[lane] = 0;
+        }
+    }
+
+    if (b->finished_count[lane] == n) {
+        b->wake[lane] = NO_EVENT;
+        return;
+    }
+
+    Engine engine;
+    engine_start(&engine, time);
+    if (b->next_arrival[lane] < n) {
+        engine_schedule(&engine, b->arrival[VARIANT_AT(b, b->order[VARIANT_AT(b, b->next_arrival[lane], lane)], lane)]);
+    }
+
+    int io_at = -1;
+    if (b->io_size[lane] > 0) {
+        io_at = VARIANT_AT(b, b->io_queue[VARIANT_AT(b, b->io_head[lane], lane)], lane);
+        engine_schedule(&engine, b->io_due[io_at]);
+    }
+
+    int run_at = -1;
+    if (b->ready_size[lane] > 0) {
+        int i = b->ready[VARIANT_AT(b, b->ready_head[lane], lane)];
+        run_at = VARIANT_AT(b, i, lane);
+        engine_schedule_burst(&engine, b->remaining[run_at], b->executed[run_at], lane_next_io(b, lane, i), 1);
+        engine_schedule_quantum(&engine, b->used_quantum[lane], quantum);
+    }
+
+    if (engine.next_event == NO_EVENT && io_at == -1 && run_at == -1) {
+        /* Nothing can happen any more; RoundRobin_Algo would spin forever. */
+        b->wake[lane] = NO_EVENT;
+        return;
+    }
+
+    sim_time_t quiet = engine_quiet_ticks(&engine);
+    if (run_at != -1 && quiet > 0) {
+        if (b->first_run[run_at] < 0) b->first_run[run_at] = time + 1;
+        b->executed[run_at] += quiet;
+        b->remaining[run_at] -= quiet;
+        b->used_quantum[lane] += quiet;
+        b->busy[lane] += quiet;
+    }
+    b->wake[lane] = time + quiet + 1;
+}
+
+static void collect_metrics(VariantBatch *b, VariantMetrics *metrics) {
+    for (int lane = 0; lane < b->lanes; lane++) {
+        VariantMetrics *m = &metrics[lane];
+        double turnaround = 0, waiting = 0, response = 0;
+
+        m->finished = 0;
+        m->makespan = 0;
+        m->busy = b->busy[lane];
+        for (int i = 0; i < b->count; i++) {
+            int at = VARIANT_AT(b, i, lane);
+            if (!b->finished[at]) continue;
+
+            sim_time_t t = b->completion[at] - b->arrival[at];
+            turnaround += t;
+            waiting += t - b->burst[at];
+            response += b->first_run[at] - b->arrival[at];
+            if (b->completion[at] > m->makespan) m->makespan = b->completion[at];
+            m->finished++;
+        }
+
+        m->avg_turnaround = m->finished ? turnaround / m->finished : 0;
+        m->avg_waiting = m->finished ? waiting / m->finished : 0;
+        m->avg_response = m->finished ? response / m->finished : 0;
+    }
+}
+
+/*
+ * All lanes share one clock. Each round moves it to the earliest tick at
+ * which some lane has an event and steps every lane due at that tick;
+ * variants with similar workloads mostly wake together, and a lane with
+ * no event at the current tick is not touched.
+ */
+void variant_batch_round_robin(VariantBatch *b, int quantum, VariantMetrics *metrics) {
+    reset_lanes(b);
+    if (b->count <= 0) {
+        for (int lane = 0; lane < b->lanes; lane++) b->wake[lane] = NO_EVENT;
+    }
+
+    for (;;) {
+        sim_time_t now = NO_EVENT;
+        for (int lane = 0; lane < b->lanes; lane++) {
+            now = b->wake[lane] < now ? b->wake[lane] : now;
+        }
+        if (now == NO_EVENT) break;
+
+        for (int lane = 0; lane < b->lanes; lane++) {
+            if (b->wake[lane] == now) {
+                round_robin_step(b, lane, now, quantum);
+            }
+        }
+    }
+
+    collect_metrics(b, metrics);
+}
+
+
+int variant_batch_config(const VariantBatch *b, int lane, Config *dst) {
+    if (!config_copy(dst, b->config)) return 0;
+    for (int i = 0; i < b->count; i++) {
+        dst->processes[i].arrival_time = b->arrival[VARIANT_AT(b, i, lane)];
+        dst->processes[i].execution_time = b->burst[VARIANT_AT(b, i, lane)];
+    }
+    return 1;
+}
+
+int variant_batch_check(const VariantBatch *b, int lane, int quantum, const VariantMetrics *metrics) {
+    Config config = {0};
+    SimContext *ctx = variant_batch_config(b, lane, &config) ? sim_context_create(&config) : NULL;
+    config_release(&config);
+    if (!ctx) return -1;
+
+    sim_context_set_console(ctx, NULL);
+    SchedulerParams params = { quantum, 0, 0 };
+    if (sim_run(ctx, "Round_Robin", &params) != 0) {
+        sim_context_destroy(ctx);
+        return -1;
+    }
+
+    SimMetrics m;
+    sim_context_metrics(ctx, &m);
+    sim_context_destroy(ctx);
+
+    const VariantMetrics *v = &metrics[lane];
+    return m.finished == v->finished && m.makespan == v->makespan && m.busy == v->busy &&
+           m.avg_turnaround == v->avg_turnaround && m.avg_waiting == v->avg_waiting &&
+           m.avg_response == v->avg_response;
+}
@@ -0,0 +1,93 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#ifndef VARIANT_BATCH_H
+
+#define VARIANT_BATCH_H
+
+#include "../Config/config.h"
+
+/*
+ * K variants of one configuration simulated together. A variant only
+ * differs from the configuration by the arrival time and burst of its
+ * processes; the I/O operations are shared.
+ *
+ * Per-variant state is laid out in lanes: the value of process i in
+ * variant `lane` sits at VARIANT_AT(b, i, lane), so the K copies of a
+ * field are contiguous and a step applied to every variant walks
+ * memory linearly.
+ */
+#define VARIANT_AT(b, i, lane) ((i) * (b)->lanes + (lane))
+
+typedef struct {
+    Config *config;
+    int count;
+    int lanes;
+
+    /* Workload of each variant, copied from the configuration. */
+    sim_time_t *arrival;
+    sim_time_t *burst;
+
+    /* Simulation state, process x lane. */
+    sim_time_t *remaining;
+    sim_time_t *executed;
+    sim_time_t *io_due;     /* tick the I/O in progress or queued completes */
+    sim_time_t *completion;
+    sim_time_t *first_run;
+    int *io_index;
+    int *finished;
+    int *order;
+    int *ready;
+    int *io_queue;
+    int *sort_order;        /* count entries, scratch for sorting the arrivals */
+
+    /* Simulation state, one value per lane. */
+    sim_time_t *wake;
+    sim_time_t *used_quantum;
+    sim_time_t *busy;
+    sim_time_t *io_busy_until;  /* due time of the last I/O queued on the device */
+    int *next_arrival;
+    int *ready_head;
+    int *ready_size;
+    int *io_head;
+    int *io_size;
+    int *finished_count;
+} VariantBatch;
+
+typedef struct {
+    int finished;           /* processes completed; below count if the run stalled */
+    sim_time_t makespan;
+    sim_time_t busy;        /* ticks the CPU executed a process */
+    double avg_turnaround;
+    double avg_waiting;
+    double avg_response;
+} VariantMetrics;
+
+/* NULL if the memory cannot be allocated. */
+VariantBatch* variant_batch_create(Config *config, int lanes);
+
+void variant_batch_destroy(VariantBatch *b);
+
+/* Perturbations leave lane 0 as the unmodified configuration. */
+void variant_batch_jitter_arrivals(VariantBatch *b, sim_time_t max_shift, unsigned int seed);
+
+void variant_batch_scale_bursts(VariantBatch *b, double min_scale, double max_scale, unsigned int seed);
+
+/* Round Robin over every lane in lockstep; fills metrics[lanes]. */
+void variant_batch_round_robin(VariantBatch *b, int quantum, VariantMetrics *metrics);
+
+/* Deep copy of the configuration of variant lane into the empty dst; 0 if out of memory. */
+int variant_batch_config(const VariantBatch *b, int lane, Config *dst);
+
+/*
+ * Runs RoundRobin_Algo on variant lane and compares its metrics with
+ * metrics[lane], as filled by variant_batch_round_robin: 1 if they are
+ * the same, 0 if not, -1 if the run failed.
+ */
+int variant_batch_check(const VariantBatch *b, int lane, int quantum, const VariantMetrics *metrics);
+
+#endif
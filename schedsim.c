@@ -0,0 +1,624 @@
+/*
+ * Simulateur d'Ordonnancement de Processus
+ * Copyright (c) 2025 Équipe ProjetSE - Université Virtuelle de Tunis
+ *
+ * Licensed under the MIT License
+ * See LICENSE file in the project root for full license information.
+ */
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "./Config/config.h"
+#include "./Utils/Algorithms.h"
+#include "./Utils/sim_context.h"
+#include "./Utils/compare.h"
+#include "./Utils/sweep.h"
+#include "./Utils/tuner.h"
+#include "./Utils/monte_carlo.h"
+#include "./Utils/matrix.h"
+#include "./Utils/variant_batch.h"
+#include "./Utils/result_cache.h"
+#include "./Utils/snapshot.h"
+
+#define MAX_STATE_TIMES 64
+
+
+static void usage(const char *program) {
+    fprintf(stderr,
+        "Usage: %s [options] <config file> <algorithm | all>\n"
+        "       %s -D [options] <config directory> <algorithm | all>\n"
+        "  -q <n>     quantum (default 2)\n"
+        "  -a <n>     aging interval (default 3)\n"
+        "  -p <n>     maximum priority (default 5)\n"
+        "  -s         do not print the simulation trace\n"
+        "  -n         do not write the log file in output/\n"
+        "  -m <file>  write the metrics to <file> instead of stdout\n"
+        "  -C <dir>   reuse the result of an identical earlier run cached in <dir>\n"
+        "  -K <file>  checkpoint the run to <file>, resuming from it if it holds this run\n"
+        "  -k <sec>   with -K, seconds between two checkpoints (default 60)\n"
+        "  -Z <t,...> print the state of the run at each of these times\n"
+        "  -w         sweep the ranges given to -q, -a and -p (4, 1-8, 2-32:2, 3,5,7)\n"
+        "  -T <obj>   tune the parameters for an objective (makespan, avg_waiting,\n"
+        "             max_waiting, p95_waiting, avg_turnaround, avg_response, utilization)\n"
+        "             searching the ranges of -q, -a and -p\n"
+        "  -t <x>     with -T, minimum throughput in processes per tick\n"
+        "  -M <n>     Monte Carlo: n seeded replications of a random workload\n"
+        "  -S <seed>  with -M, seed of the replications (default 1)\n"
+        "  -A <dist>  with -M, gaps between arrivals: fixed, shift:n, scale:a,b or exp\n"
+        "  -B <dist>  with -M, execution times (same forms)\n"
+        "  -I <dist>  with -M, I/O durations (same forms)\n"
+        "  -V <n>     Round_Robin over n variants of the configuration, in lockstep\n"
+        "  -J <n>     with -V, shift each arrival by up to n ticks (seeded by -S)\n"
+        "  -X <a,b>   with -V, scale each burst by a factor in [a, b] (seeded by -S)\n"
+        "  -c         with -V, check every variant against a run of Round_Robin\n"
+        "  -D         run every configuration of the directory, in worker processes\n"
+        "  -j <n>     worker threads, or processes with -D (default: one per CPU)\n"
+        "  -L <sec>   with -D, seconds a run may take before its worker is killed\n"
+        "             (default 300, 0: no limit)\n"
+        "  -l         list the algorithms\n",
+        program, program);
+}
+
+
+static void list_schedulers(void) {
+    for (int i = 0; i < scheduler_count; i++) {
+        printf("%s%s%s\n", schedulers[i].name,
+               schedulers[i].needs_quantum ? " (quantum)" : "",
+               schedulers[i].needs_aging ? " (aging)" : "");
+    }
+}
+
+
+static int parse_positive(const char *text, const char *name, int *value) {
+    char *end;
+    long n = strtol(text, &end, 10);
+    if (*text == '\0' || *end != '\0' || n <= 0 || n > INT_MAX) {
+        fprintf(stderr, "Invalid %s: %s\n", name, text);
+        return 0;
+    }
+    *value = (int)n;
+    return 1;
+}
+
+
+static int parse_times(const char *text, sim_time_t *times, int max) {
+    int count = 0;
+    const char *p = text;
+    while (count < max) {
+        char *end;
+        long long t = strtoll(p, &end, 10);
+        if (end == p || t < 0 || (*end != ',' && *end != '\0')) break;
+        times[count++] = t;
+        if (*end == '\0') return count;
+        p = end + 1;
+    }
+    fprintf(stderr, "Invalid times: %s (at most %d, comma separated)\n", text, max);
+    return 0;
+}
+
+
+static int parse_range_option(const char *text, const char *name, ParamRange *range) {
+    if (!parse_param_range(text, range)) {
+        fprintf(stderr, "Invalid %s range: %s\n", name, text);
+        return 0;
+    }
+    return 1;
+}
+
+
+static void print_metrics(FILE *out, const SimContext *ctx, const Scheduler *scheduler, const SchedulerParams *params) {
+    SimMetrics m;
+    sim_context_metrics(ctx, &m);
+    const char *unit = ctx->config.time_unit[0] ? ctx->config.time_unit : "ticks";
+
+    fprintf(out, "algorithm: %s\n", scheduler->name);
+    if (scheduler->needs_quantum) fprintf(out, "quantum: %d\n", params->quantum);
+    if (scheduler->needs_aging) {
+        fprintf(out, "aging_interval: %d\n", params->aging_interval);
+        fprintf(out, "max_priority: %d\n", params->max_priority);
+    }
+    fprintf(out, "time_unit: %s\n", unit);
+    fprintf(out, "processes: %d\n", ctx->config.process_count);
+    fprintf(out, "finished: %d\n", m.finished);
+    fprintf(out, "makespan: %lld\n", m.makespan);
+    fprintf(out, "cpu_busy: %lld\n", m.busy);
+    fprintf(out, "cpu_utilization: %.4f\n", m.makespan > 0 ? (double)m.busy / m.makespan : 0.0);
+    fprintf(out, "avg_turnaround: %.4f\n", m.avg_turnaround);
+    fprintf(out, "avg_waiting: %.4f\n", m.avg_waiting);
+    fprintf(out, "max_waiting: %lld\n", m.max_waiting);
+    fprintf(out, "p95_waiting: %lld\n", m.p95_waiting);
+    fprintf(out, "avg_response: %.4f\n", m.avg_response);
+
+    fprintf(out, "\nprocess arrival burst first_run completion turnaround waiting\n");
+    for (int i = 0; i < ctx->tracked; i++) {
+        const PROCESS *p = &ctx->config.processes[i];
+        if (ctx->first_run[i] < 0) {
+            fprintf(out, "%s %lld %lld - - - -\n", p->ID, p->arrival_time, p->execution_time);
+            continue;
+        }
+        sim_time_t turnaround = ctx->completion[i] - p->arrival_time;
+        fprintf(out, "%s %lld %lld %lld %lld %lld %lld\n", p->ID, p->arrival_time, p->execution_time,
+                ctx->first_run[i], ctx->completion[i], turnaround, turnaround - p->execution_time);
+    }
+}
+
+
+/* stdout unless a metrics file is given. */
+static FILE* open_output(const char *path) {
+    if (!path) return stdout;
+    FILE *out = fopen(path, "w");
+    if (!out) fprintf(stderr, "Could not create metrics file %s\n", path);
+    return out;
+}
+
+
+static const char* base_name(const char *path) {
+    const char *slash = strrchr(path, '/');
+    return slash ? slash + 1 : path;
+}
+
+
+static int run_single(FILE *out, const Config *config, const Scheduler *scheduler,
+                      const SchedulerParams *params, const char *log_name, int quiet,
+                      const char *cache_dir, const char *checkpoint_path, double checkpoint_interval,
+                      const sim_time_t *state_times, int state_count) {
+    SimContext *ctx = sim_context_create(config);
+    if (!ctx) return 2;
+
+    SnapshotIndex *snapshots = NULL;
+    if (state_count > 0) {
+        snapshots = snapshot_index_create(SNAPSHOT_INTERVAL);
+        if (!snapshots) {
+            sim_context_destroy(ctx);
+            return 2;
+        }
+        /* A cached run is not simulated: its states are then replayed from the start. */
+        snapshot_index_start(snapshots, scheduler, params);
+        ctx->snapshots = snapshots;
+    }
+
+    if (quiet) sim_context_set_console(ctx, NULL);
+    /* Before the log is opened, which a resumed run carries on. */
+    if (checkpoint_path &&
+        sim_context_set_checkpoint(ctx, checkpoint_path, checkpoint_interval, scheduler, params) == 1) {
+        fprintf(stderr, "Resuming from checkpoint %s\n", checkpoint_path);
+    }
+    if (log_name && sim_context_open_log(ctx, scheduler->name, log_name) != 0) {
+        sim_context_destroy(ctx);
+        return 2;
+    }
+
+    int status;
+    if (cache_dir) {
+        ResultCache *cache = result_cache_create(cache_dir, RESULT_CACHE_MEMORY_LIMIT, RESULT_CACHE_DISK_LIMIT);
+        if (!cache) {
+            sim_context_destroy(ctx);
+            return 2;
+        }
+        status = result_cache_run(cache, ctx, scheduler->name, params);
+        if (status == 1 && !quiet) {
+            printf("Result loaded from the cache in %s\n", cache_dir);
+        }
+        result_cache_destroy(cache);
+    } else {
+        status = sim_run(ctx, scheduler->name, params);
+    }
+    if (status < 0) {
+        fprintf(stderr, "%s did not complete: %s\n", scheduler->name, ctx->error);
+        snapshot_index_destroy(snapshots);
+        sim_context_destroy(ctx);
+        return 2;
+    }
+
+    if (out == stdout && !quiet) fprintf(out, "\n");
+    print_metrics(out, ctx, scheduler, params);
+
+    for (int i = 0; i < state_count; i++) {
+        SimState state;
+        fprintf(out, "\n");
+        if (sim_state_at(snapshots, &ctx->config, &ctx->timeline, state_times[i], &state) == 0) {
+            sim_state_print(out, &state, &ctx->config);
+        }
+        sim_state_release(&state);
+    }
+    snapshot_index_destroy(snapshots);
+    sim_context_destroy(ctx);
+    return 0;
+}
+
+
+static int run_compare(FILE *out, const Config *config, const SchedulerParams *params,
+                       const char *log_name, int threads) {
+    ThreadPool *pool = thread_pool_create(threads);
+    if (!pool) return 2;
+
+    CompareResult results[scheduler_count];
+    compare_schedulers(pool, config, params, log_name, results);
+    thread_pool_destroy(pool);
+
+    fprintf(out, "quantum: %d, aging_interval: %d, max_priority: %d\n\n",
+            params->quantum, params->aging_interval, params->max_priority);
+    compare_print_table(out, results, scheduler_count);
+    return 0;
+}
+
+
+static int run_sweep(FILE *out, const Config *config, const Scheduler *scheduler,
+                     const ParamRange *quantum, const ParamRange *aging_interval,
+                     const ParamRange *max_priority, int threads) {
+    Sweep *sweep = sweep_create(scheduler, quantum, aging_interval, max_priority);
+    if (!sweep) return 2;
+
+    ThreadPool *pool = thread_pool_create(threads);
+    if (!pool) {
+        sweep_destroy(sweep);
+        return 2;
+    }
+    sweep_run(sweep, pool, config);
+    thread_pool_destroy(pool);
+
+    sweep_print_table(out, sweep);
+    fprintf(out, "\n");
+    sweep_print_best(out, sweep);
+    sweep_destroy(sweep);
+    return 0;
+}
+
+
+static int run_tuner(FILE *out, const Config *config, const TunerSpec *spec, int threads) {
+    ThreadPool *pool = thread_pool_create(threads);
+    if (!pool) return 2;
+
+    Tuner *tuner = tuner_run(spec, pool, config);
+    thread_pool_destroy(pool);
+    if (!tuner) return 2;
+
+    tuner_print(out, tuner);
+    tuner_destroy(tuner);
+    return 0;
+}
+
+
+/* A NULL scheduler runs every algorithm of the table. */
+static int run_monte_carlo(FILE *out, const Config *config, const WorkloadModel *model,
+                           const Scheduler *scheduler, const SchedulerParams *params,
+                           int replications, unsigned long long seed, int threads) {
+    const Scheduler *selected[scheduler_count];
+    int count = 0;
+    for (int i = 0; i < scheduler_count; i++) {
+        if (!scheduler || scheduler == &schedulers[i]) selected[count++] = &schedulers[i];
+    }
+
+    ThreadPool *pool = thread_pool_create(threads);
+    if (!pool) return 2;
+
+    MonteCarlo *mc = monte_carlo_run(pool, config, model, selected, count, params, replications, seed);
+    thread_pool_destroy(pool);
+    if (!mc) return 2;
+
+    monte_carlo_print(out, mc);
+    monte_carlo_destroy(mc);
+    return 0;
+}
+
+
+/* Variant 0 is the configuration itself; the others are perturbed from seed. */
+static int run_variants(FILE *out, Config *config, const SchedulerParams *params, int variants,
+                        sim_time_t jitter, double min_scale, double max_scale,
+                        unsigned long long seed, int check) {
+    VariantBatch *b = variant_batch_create(config, variants);
+    VariantMetrics *metrics = malloc(variants * sizeof(VariantMetrics));
+    if (!b || !metrics) {
+        fprintf(stderr, "Memory allocation failed for %d variants\n", variants);
+        variant_batch_destroy(b);
+        free(metrics);
+        return 2;
+    }
+
+    if (jitter > 0) variant_batch_jitter_arrivals(b, jitter, (unsigned int)seed);
+    if (min_scale != 1 || max_scale != 1) variant_batch_scale_bursts(b, min_scale, max_scale, (unsigned int)seed + 1);
+    variant_batch_round_robin(b, params->quantum, metrics);
+
+    fprintf(out, "quantum: %d, variants: %d\n\n", params->quantum, variants);
+    fprintf(out, "variant,finished,makespan,cpu_busy,avg_turnaround,avg_waiting,avg_response%s\n",
+            check ? ",check" : "");
+    int differ = 0;
+    for (int lane = 0; lane < variants; lane++) {
+        const VariantMetrics *m = &metrics[lane];
+        fprintf(out, "%d,%d,%lld,%lld,%.4f,%.4f,%.4f", lane, m->finished, m->makespan, m->busy,
+                m->avg_turnaround, m->avg_waiting, m->avg_response);
+        if (check) {
+            int same = variant_batch_check(b, lane, params->quantum, metrics);
+            fprintf(out, ",%s", same == 1 ? "ok" : same == 0 ? "differs" : "failed");
+            if (same != 1) differ++;
+        }
+        fprintf(out, "\n");
+    }
+    if (check) {
+        fprintf(out, "\n%d of %d variants differ from Round_Robin\n", differ, variants);
+    }
+
+    variant_batch_destroy(b);
+    free(metrics);
+    return differ > 0 ? 2 : 0;
+}
+
+
+/* A NULL scheduler runs every algorithm of the table. */
+static int run_matrix(FILE *out, const char *dir, const Scheduler *scheduler,
+                      const SchedulerParams *params, int write_log, int workers, double timeout) {
+    const Scheduler *selected[scheduler_count];
+    int count = 0;
+    for (int i = 0; i < scheduler_count; i++) {
+        if (!scheduler || scheduler == &schedulers[i]) selected[count++] = &schedulers[i];
+    }
+
+    Matrix *m = matrix_create(dir, selected, count, params, write_log);
+    if (!m) {
+        fprintf(stderr, "No configuration found in '%s'\n", dir);
+        return 2;
+    }
+
+    int failed = matrix_run(m, workers, timeout);
+    matrix_print(out, m);
+    matrix_destroy(m);
+    return failed > 0 ? 2 : 0;
+}
+
+
+int main(int argc, char **argv) {
+    SchedulerParams params = { 2, 3, 5 };
+    int quiet = 0;
+    int write_log = 1;
+    const char *metrics_path = NULL;
+    const char *cache_dir = NULL;
+    const char *checkpoint_path = NULL;
+    double checkpoint_interval = 60;
+    sim_time_t state_times[MAX_STATE_TIMES];
+    int state_count = 0;
+    int threads = 0;
+    int sweep = 0;
+    int matrix = 0;
+    double run_timeout = 300;
+    int objective = -1;
+    double min_throughput = 0;
+    int replications = 0;
+    int variants = 0;
+    sim_time_t jitter = 0;
+    double min_scale = 1, max_scale = 1;
+    int check = 0;
+    unsigned long long seed = 1;
+    WorkloadModel model = { { DIST_FIXED, 0, 0 }, { DIST_FIXED, 0, 0 }, { DIST_FIXED, 0, 0 } };
+    const char *quantum_text = NULL;
+    const char *aging_text = NULL;
+    const char *priority_text = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "q:a:p:snm:C:K:k:Z:j:wT:t:M:S:A:B:I:V:J:X:cDL:lh")) != -1) {
+        switch (opt) {
+            case 'q':
+                quantum_text = optarg;
+                break;
+            case 'a':
+                aging_text = optarg;
+                break;
+            case 'p':
+                priority_text = optarg;
+                break;
+            case 'w':
+                sweep = 1;
+                break;
+            case 'T':
+                objective = find_sweep_metric(optarg);
+                if (objective < 0) {
+                    fprintf(stderr, "Unknown objective: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 't': {
+                char *end;
+                min_throughput = strtod(optarg, &end);
+                if (*end != '\0' || min_throughput < 0) {
+                    fprintf(stderr, "Invalid throughput: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 's':
+                quiet = 1;
+                break;
+            case 'n':
+                write_log = 0;
+                break;
+            case 'm':
+                metrics_path = optarg;
+                break;
+            case 'C':
+                cache_dir = optarg;
+                break;
+            case 'K':
+                checkpoint_path = optarg;
+                break;
+            case 'k': {
+                char *end;
+                checkpoint_interval = strtod(optarg, &end);
+                if (*optarg == '\0' || *end != '\0' || checkpoint_interval < 0) {
+                    fprintf(stderr, "Invalid checkpoint interval: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'Z':
+                state_count = parse_times(optarg, state_times, MAX_STATE_TIMES);
+                if (state_count == 0) return 1;
+                break;
+            case 'j':
+                if (!parse_positive(optarg, "thread count", &threads)) return 1;
+                break;
+            case 'M':
+                if (!parse_positive(optarg, "replication count", &replications)) return 1;
+                break;
+            case 'S': {
+                char *end;
+                seed = strtoull(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0') {
+                    fprintf(stderr, "Invalid seed: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'A':
+            case 'B':
+            case 'I': {
+                Distribution *dist = opt == 'A' ? &model.arrival : opt == 'B' ? &model.burst : &model.io_duration;
+                if (!parse_distribution(optarg, dist)) {
+                    fprintf(stderr, "Invalid distribution: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'V':
+                if (!parse_positive(optarg, "variant count", &variants)) return 1;
+                break;
+            case 'J': {
+                char *end;
+                jitter = strtoll(optarg, &end, 10);
+                if (*optarg == '\0' || *end != '\0' || jitter < 0) {
+                    fprintf(stderr, "Invalid arrival shift: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'X':
+                if (sscanf(optarg, "%lf,%lf", &min_scale, &max_scale) != 2 ||
+                    min_scale < 0 || max_scale < min_scale) {
+                    fprintf(stderr, "Invalid burst scale: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'c':
+                check = 1;
+                break;
+            case 'D':
+                matrix = 1;
+                break;
+            case 'L': {
+                char *end;
+                run_timeout = strtod(optarg, &end);
+                if (*optarg == '\0' || *end != '\0' || run_timeout < 0) {
+                    fprintf(stderr, "Invalid run timeout: %s\n", optarg);
+                    return 1;
+                }
+                break;
+            }
+            case 'l':
+                list_schedulers();
+                return 0;
+            case 'h':
+                usage(argv[0]);
+                return 0;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (argc - optind != 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    int tune = objective >= 0;
+    if (sweep + tune + (replications > 0) + matrix + (variants > 0) > 1) {
+        fprintf(stderr, "-w, -T, -M, -D and -V cannot be combined\n");
+        return 1;
+    }
+    if (checkpoint_path && (sweep || tune || replications > 0 || matrix || variants > 0 || strcmp(argv[optind + 1], "all") == 0)) {
+        fprintf(stderr, "-K checkpoints a single run of one algorithm\n");
+        return 1;
+    }
+    if (state_count > 0 && (sweep || tune || replications > 0 || matrix || variants > 0 || strcmp(argv[optind + 1], "all") == 0)) {
+        fprintf(stderr, "-Z reads the states of a single run of one algorithm\n");
+        return 1;
+    }
+
+    /* The tuner searches wide ranges unless given others. */
+    if (!quantum_text) quantum_text = tune ? "1-100" : "2";
+    if (!aging_text) aging_text = tune ? "1-32" : "3";
+    if (!priority_text) priority_text = tune ? "1-16" : "5";
+
+    ParamRange ranges[3];
+    if (sweep || tune) {
+        if (!parse_range_option(quantum_text, "quantum", &ranges[0]) ||
+            !parse_range_option(aging_text, "aging interval", &ranges[1]) ||
+            !parse_range_option(priority_text, "maximum priority", &ranges[2])) return 1;
+    } else {
+        if (!parse_positive(quantum_text, "quantum", &params.quantum) ||
+            !parse_positive(aging_text, "aging interval", &params.aging_interval) ||
+            !parse_positive(priority_text, "maximum priority", &params.max_priority)) return 1;
+    }
+
+    char config_path[512];
+    strncpy(config_path, argv[optind], sizeof(config_path) - 1);
+    config_path[sizeof(config_path) - 1] = '\0';
+    const char *algorithm = argv[optind + 1];
+    int compare_all = strcmp(algorithm, "all") == 0;
+    const Scheduler *scheduler = compare_all ? NULL : find_scheduler(algorithm);
+
+    if ((sweep || tune) && compare_all) {
+        fprintf(stderr, "Sweeps and tuning run a single algorithm\n");
+        return 1;
+    }
+    if (!compare_all && !scheduler) {
+        fprintf(stderr, "Unknown algorithm '%s' (see -l)\n", algorithm);
+        return 2;
+    }
+    if (variants > 0 && scheduler != find_scheduler("Round_Robin")) {
+        fprintf(stderr, "Variants run Round_Robin only\n");
+        return 1;
+    }
+
+    if (matrix) {
+        FILE *out = open_output(metrics_path);
+        if (!out) return 2;
+        int status = run_matrix(out, config_path, scheduler, &params, write_log, threads, run_timeout);
+        if (out != stdout) fclose(out);
+        return status;
+    }
+
+    Config config = {0};
+    if (!load_config(config_path, &config)) {
+        fprintf(stderr, "Could not load configuration '%s'\n", config_path);
+        config_release(&config);
+        return 2;
+    }
+
+    FILE *out = open_output(metrics_path);
+    if (!out) {
+        config_release(&config);
+        return 2;
+    }
+
+    int status;
+    if (variants > 0) {
+        status = run_variants(out, &config, &params, variants, jitter, min_scale, max_scale, seed, check);
+    } else if (replications > 0) {
+        status = run_monte_carlo(out, &config, &model, scheduler, &params, replications, seed, threads);
+    } else if (sweep) {
+        status = run_sweep(out, &config, scheduler, &ranges[0], &ranges[1], &ranges[2], threads);
+    } else if (tune) {
+        TunerSpec spec = { scheduler, (SweepMetric)objective, min_throughput, ranges[0], ranges[1], ranges[2] };
+        status = run_tuner(out, &config, &spec, threads);
+    } else if (compare_all) {
+        status = run_compare(out, &config, &params, write_log ? base_name(config_path) : NULL, threads);
+    } else {
+        status = run_single(out, &config, scheduler, &params, write_log ? base_name(config_path) : NULL, quiet, cache_dir,
+                            checkpoint_path, checkpoint_interval, state_times, state_count);
+    }
+
+    config_release(&config);
+    if (out != stdout) fclose(out);
+    return status;
+}